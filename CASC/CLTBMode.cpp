@@ -85,7 +85,9 @@ void CLTBMode::perform()
     USER_ERROR("Cannot open input file: " + env.options->inputFile());
   }
 
-  //support several batches in one file
+  //support several batches in one file; they share one CLTBMode object, so that
+  //libraries loaded for one batch stay resident for the following ones
+  CLTBMode ltbm;
   bool firstBatch=true;
   while (!in.eof()) {
     vostringstream singleInst;
@@ -101,7 +103,6 @@ void CLTBMode::perform()
     if (!ready) {
       break;
     }
-    CLTBMode ltbm;
     vistringstream childInp(singleInst.str());
     ltbm.solveBatch(childInp,firstBatch,inputDirectory);
     firstBatch=false;
@@ -127,12 +128,16 @@ void CLTBMode::solveBatch(istream& batchFile, bool first,vstring inputDirectory)
   // this is the time in milliseconds since the start when this batch file should terminate
   _timeUsedByPreviousBatches = env.timer->elapsedMilliseconds();
   coutLineOutput() << "Starting Vampire on the batch file " << "\n";
+  _problemFiles.reset();
   int terminationTime = readInput(batchFile,first);
   loadIncludes();
 
   _biasedLearning = false;
+  // learning starts afresh with each batch, even though the object is shared
+  _learnedFormulas.reset();
+  _learnedFormulasCount.reset();
+  _learnedFormulasMaxCount = 1;
   if (env.options->ltbLearning() != Options::LTBLearning::OFF){
-    _learnedFormulasMaxCount = 1;
     _biasedLearning = (env.options->ltbLearning() == Options::LTBLearning::BIASED);
     doTraining();
   }
@@ -237,8 +242,34 @@ void CLTBMode::solveBatch(istream& batchFile, bool first,vstring inputDirectory)
   env.endOutput();
 } // CLTBMode::solveBatch(batchFile)
 
+/**
+ * Parse the theory includes of the current batch into @b _baseProblem.
+ *
+ * If the previous batch used the same includes, the already parsed base
+ * problem is kept: it is only ever extended in the forked child processes,
+ * so it is still pristine here.
+ */
 void CLTBMode::loadIncludes()
 {
+  if (_baseProblem && _loadedIncludes.size() == StringList::length(_theoryIncludes)) {
+    bool same = true;
+    unsigned i = 0;
+    StringList::Iterator iit(_theoryIncludes);
+    while (iit.hasNext()) {
+      if (iit.next() != _loadedIncludes[i++]) {
+        same = false;
+        break;
+      }
+    }
+    if (same) {
+      coutLineOutput() << "reusing the includes loaded for the previous batch" << endl;
+      env.setMainProblem(_baseProblem.ptr());
+      return;
+    }
+  }
+  _loadedIncludes.reset();
+  _loadedIncludes.loadFromIterator(StringList::Iterator(_theoryIncludes));
+
   UnitList* theoryAxioms=0;
   {
     TIME_TRACE(TimeTrace::PARSING);
@@ -93,6 +93,8 @@ private:
 
   /** files to be included */
   StringList* _theoryIncludes;
+  /** files from which @b _baseProblem was loaded */
+  StringStack _loadedIncludes;
 
   /** The first vstring in the pair is problem file, the second
    * one is output file. The problemFiles[0] is the first
@@ -13,9 +13,11 @@
  * Implements class PortfolioMode.
  */
 
+#include "Lib/DHMap.hpp"
 #include "Lib/Environment.hpp"
 #include "Lib/Int.hpp"
 #include "Lib/Portability.hpp"
+#include "Lib/Random.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/System.hpp"
 #include "Lib/ScopedLet.hpp"
@@ -24,6 +26,7 @@
 #include "Lib/Sys/Multiprocessing.hpp"
 
 #include "Shell/Options.hpp"
+#include "Shell/Preprocess.hpp"
 #include "Shell/Statistics.hpp"
 #include "Shell/UIHelper.hpp"
 #include "Shell/Normalisation.hpp"
@@ -32,6 +35,7 @@
 
 #include <unistd.h>
 #include <signal.h>
+#include <sys/wait.h>
 #include <fstream>
 #include <stdio.h>
 #include <cstdio>
@@ -49,7 +53,7 @@ using namespace std;
 using namespace Lib;
 using namespace CASC;
 
-PortfolioMode::PortfolioMode() : _slowness(1.0), _syncSemaphore(2) {
+PortfolioMode::PortfolioMode() : _slowness(1.0), _preprocessed(false), _syncSemaphore(2) {
   unsigned cores = System::getNumberOfCores();
   cores = cores < 1 ? 1 : cores;
   _numWorkers = min(cores, env.options->multicore());
@@ -413,8 +417,11 @@ void PortfolioMode::getSchedules(const Property& prop, Schedule& quick, Schedule
 bool PortfolioMode::runSchedule(Schedule schedule) {
   TIME_TRACE("run schedule");
 
-  Schedule::BottomFirstIterator it(schedule);
-  Set<pid_t> processes;
+  unsigned nextSlice = 0;
+  // running processes and the schedule index of the slice each of them runs (or started with)
+  DHMap<pid_t, unsigned> processes;
+  // processes stopped at their slice's limit (see --portfolio_paused_slices), by schedule index
+  DHMap<unsigned, pid_t> paused;
   bool success = false;
   int remainingTime;
   while(Timer::syncClock(), remainingTime = env.remainingTime() / 100, remainingTime > 0)
@@ -424,30 +431,54 @@ bool PortfolioMode::runSchedule(Schedule schedule) {
     {
       // after exhaustion we replace the schedule
       // by copies with x2 time limits and do this forever
-      if(!it.hasNext()) {
+      if(nextSlice == schedule.size()) {
         Schedule next;
         rescaleScheduleLimits(schedule, next, 2.0);
         schedule = next;
-        it = Schedule::BottomFirstIterator(schedule);
+        nextSlice = 0;
+      }
+      ASS_L(nextSlice, schedule.size());
+
+      // this slice got paused on the previous pass, continue it instead of starting over
+      pid_t pausedProcess;
+      if(paused.pop(nextSlice, pausedProcess)) {
+        Multiprocessing::instance()->killNoCheck(pausedProcess, SIGCONT);
+        ALWAYS(processes.insert(pausedProcess, nextSlice));
+        nextSlice++;
+        continue;
+      }
+
+      // the slices right after this one which can be run from the same preprocessed problem
+      unsigned groupEnd = nextSlice+1;
+      if(env.options->portfolioSharedPreprocessing()) {
+        vstring fingerprint = preprocessingFingerprint(schedule[nextSlice]);
+        while(groupEnd < schedule.size() && preprocessingFingerprint(schedule[groupEnd]) == fingerprint) {
+          groupEnd++;
+        }
       }
-      ALWAYS(it.hasNext());
 
-      vstring code = it.next();
       pid_t process = Multiprocessing::instance()->fork();
       ASS_NEQ(process, -1);
       if(process == 0)
       {
         TIME_TRACE_NEW_ROOT("child process")
-        runSlice(code, remainingTime);
+        if(groupEnd == nextSlice+1) {
+          // grouped slices are not paused: runSliceGroup waits for each of them to terminate
+          Timer::setPauseAtLimit(env.options->portfolioPausedSlices() > 0);
+          runSlice(schedule[nextSlice], remainingTime);
+        } else {
+          runSliceGroup(schedule, nextSlice, groupEnd, remainingTime);
+        }
         ASSERTION_VIOLATION; // should not return
       }
-      ALWAYS(processes.insert(process));
+      ALWAYS(processes.insert(process, nextSlice));
+      nextSlice = groupEnd;
     }
 
-    bool exited, signalled;
+    bool exited, signalled, stopped;
     int code;
     // sleep until process changes state
-    pid_t process = Multiprocessing::instance()->poll_children(exited, signalled, code);
+    pid_t process = Multiprocessing::instance()->poll_children(exited, signalled, stopped, code);
 
     /*
     cout << "Child " << process
@@ -471,13 +502,28 @@ bool PortfolioMode::runSchedule(Schedule schedule) {
       env.out()<<"Child killed by signal " << code << endl;
       env.endOutput();
       ALWAYS(processes.remove(process));
+    } else if (stopped && env.options->portfolioPausedSlices()) {
+      // the slice reached its limit and paused itself, keep it around for the next pass if there is room
+      unsigned slice;
+      ALWAYS(processes.pop(process, slice));
+      if(paused.size() < env.options->portfolioPausedSlices()) {
+        ALWAYS(paused.insert(slice, process));
+      } else {
+        Multiprocessing::instance()->killNoCheck(process, SIGKILL);
+        // reap it here, so that poll_children does not report it as killed by an external agency
+        waitpid(process, nullptr, 0);
+      }
     }
   }
 
   // kill all running processes first
   decltype(processes)::Iterator killIt(processes);
   while(killIt.hasNext())
-    Multiprocessing::instance()->killNoCheck(killIt.next(), SIGINT);
+    Multiprocessing::instance()->killNoCheck(killIt.nextKey(), SIGINT);
+  // a stopped process would not act on SIGINT
+  decltype(paused)::Iterator pausedIt(paused);
+  while(pausedIt.hasNext())
+    Multiprocessing::instance()->killNoCheck(pausedIt.next(), SIGKILL);
 
   return success;
 }
@@ -571,12 +617,11 @@ unsigned PortfolioMode::getSliceTime(const vstring &sliceCode)
 } // getSliceTime
 
 /**
- * Run a slice given by its code using the specified time limit.
+ * Return the options of the slice given by its code, with the time limit
+ * of the slice cut down to @b timeLimitInDeciseconds
  */
-void PortfolioMode::runSlice(vstring sliceCode, int timeLimitInDeciseconds)
+Options PortfolioMode::sliceOptions(const vstring& sliceCode, int timeLimitInDeciseconds)
 {
-  TIME_TRACE("run slice");
-
   int sliceTime = getSliceTime(sliceCode);
   if (sliceTime > timeLimitInDeciseconds 
     || !sliceTime) // no limit set, i.e. "infinity"
@@ -585,23 +630,45 @@ void PortfolioMode::runSlice(vstring sliceCode, int timeLimitInDeciseconds)
   }
 
   ASS_GE(sliceTime,0);
+  Options opt = *env.options;
+
+  // opt.randomSeed() would normally be inherited from the parent
+  // addCommentSignForSZS(cout) << "runSlice - seed before setting: " << opt.randomSeed() << endl;    
+  if (env.options->randomizeSeedForPortfolioWorkers()) {
+    // but here we want each worker to have their own seed
+    opt.setRandomSeed(std::random_device()());
+    // ... unless a strategy sets a seed explicitly, just below
+  }
+  opt.readFromEncodedOptions(sliceCode);
+  opt.setTimeLimitInDeciseconds(sliceTime);
+  int stl = opt.simulatedTimeLimit();
+  if (stl) {
+    opt.setSimulatedTimeLimit(int(stl * _slowness));
+  }
+  return opt;
+}
+
+/**
+ * Return the preprocessing fingerprint (see Options::preprocessingFingerprint)
+ * of the slice given by its code
+ */
+vstring PortfolioMode::preprocessingFingerprint(const vstring& sliceCode)
+{
+  Options opt = *env.options;
+  opt.readFromEncodedOptions(sliceCode);
+  return opt.preprocessingFingerprint();
+}
+
+/**
+ * Run a slice given by its code using the specified time limit.
+ */
+void PortfolioMode::runSlice(vstring sliceCode, int timeLimitInDeciseconds)
+{
+  TIME_TRACE("run slice");
+
   try
   {
-    Options opt = *env.options;
-
-    // opt.randomSeed() would normally be inherited from the parent
-    // addCommentSignForSZS(cout) << "runSlice - seed before setting: " << opt.randomSeed() << endl;    
-    if (env.options->randomizeSeedForPortfolioWorkers()) {
-      // but here we want each worker to have their own seed
-      opt.setRandomSeed(std::random_device()());
-      // ... unless a strategy sets a seed explicitly, just below
-    }
-    opt.readFromEncodedOptions(sliceCode);
-    opt.setTimeLimitInDeciseconds(sliceTime);
-    int stl = opt.simulatedTimeLimit();
-    if (stl) {
-      opt.setSimulatedTimeLimit(int(stl * _slowness));
-    }
+    Options opt = sliceOptions(sliceCode, timeLimitInDeciseconds);
     runSlice(opt);
   }
   catch(Exception &e)
@@ -615,6 +682,78 @@ void PortfolioMode::runSlice(vstring sliceCode, int timeLimitInDeciseconds)
   }
 } // runSlice
 
+/**
+ * Run the slices schedule[first] ... schedule[end-1], which all share the preprocessing
+ * options, one after another within the time limit: preprocess the problem once, with
+ * the options of the first slice, and run each of the slices in a process forked from
+ * the preprocessed state. Exit with 0 as soon as one of them succeeds.
+ */
+void PortfolioMode::runSliceGroup(const Schedule& schedule, unsigned first, unsigned end, int timeLimitInDeciseconds)
+{
+  TIME_TRACE("run slice group");
+
+  System::registerForSIGHUPOnParentDeath();
+  UIHelper::portfolioParent=false;
+
+  env.timer->reset();
+  env.timer->start();
+  Timer::resetInstructionMeasuring();
+
+  // the slices are to be read on top of the options we got, not of those of the first slice
+  Options parentOpt = *env.options;
+  try
+  {
+    Options opt = sliceOptions(schedule[first], timeLimitInDeciseconds);
+    opt.setNormalize(false);
+    opt.setForcedOptionValues();
+    opt.checkGlobalOptionConstraints();
+    *env.options = opt;
+
+    // only the parent and the slices themselves watch the time, we just check it between them
+    Timer::setLimitEnforcement(false);
+    Lib::Random::setSeed(opt.randomSeed());
+    {
+      TIME_TRACE(TimeTrace::PREPROCESSING);
+      Preprocess prepro(opt);
+      prepro.preprocess(*_prb);
+    }
+  }
+  catch(Exception &e)
+  {
+    if(outputAllowed())
+    {
+      std::cerr << "% Exception at run slice group level" << std::endl;
+      e.cry(std::cerr);
+    }
+    System::terminateImmediately(1); // didn't find proof
+  }
+  catch(const std::bad_alloc &) {
+    System::terminateImmediately(1);
+  }
+  *env.options = parentOpt;
+  _preprocessed = true;
+
+  for(unsigned i = first; i < end; i++) {
+    int remainingTime = timeLimitInDeciseconds - env.timer->elapsedDeciseconds();
+    if(remainingTime <= 0) {
+      break;
+    }
+    pid_t process = Multiprocessing::instance()->fork();
+    ASS_NEQ(process, -1);
+    if(process == 0)
+    {
+      runSlice(schedule[i], remainingTime);
+      ASSERTION_VIOLATION; // should not return
+    }
+    int code;
+    ALWAYS(Multiprocessing::instance()->waitForChildTermination(code) == process);
+    if(!code) {
+      exit(0);
+    }
+  }
+  exit(1);
+} // runSliceGroup
+
 /**
  * Run a slice given by its options
  */
@@ -629,6 +768,10 @@ void PortfolioMode::runSlice(Options& strategyOpt)
 
   Timer::resetInstructionMeasuring();
   Timer::setLimitEnforcement(true);
+#if VTIME_PROFILING
+  // the instruction counter has just been restarted
+  TimeTrace::instance().setCountInstructions(env.options->timeStatisticsInstructions());
+#endif
 
   Options opt = strategyOpt;
   //we have already performed the normalization (or don't care about it)
@@ -648,7 +791,12 @@ void PortfolioMode::runSlice(Options& strategyOpt)
     env.endOutput();
   }
 
-  Saturation::ProvingHelper::runVampire(*_prb, opt);
+  if (_preprocessed) {
+    // forked by runSliceGroup from the preprocessed problem
+    Saturation::ProvingHelper::runVampireSaturation(*_prb, opt);
+  } else {
+    Saturation::ProvingHelper::runVampire(*_prb, opt);
+  }
 
   //set return value to zero if we were successful
   if (env.statistics->terminationReason == Statistics::REFUTATION ||
@@ -54,6 +54,9 @@ private:
 
   bool runSchedule(Schedule schedule);
   bool runScheduleAndRecoverProof(Schedule schedule);
+  Options sliceOptions(const vstring& sliceCode, int timeLimitInDeciseconds);
+  vstring preprocessingFingerprint(const vstring& sliceCode);
+  [[noreturn]] void runSliceGroup(const Schedule& schedule, unsigned first, unsigned end, int remainingTime);
   [[noreturn]] void runSlice(vstring sliceCode, int remainingTime);
   [[noreturn]] void runSlice(Options& strategyOpt);
 
@@ -63,6 +66,8 @@ private:
 
   unsigned _numWorkers;
   float _slowness;
+  /** true in processes forked from an already preprocessed problem by runSliceGroup */
+  bool _preprocessed;
 
   const char * _tmpFileNameForProof;
 
@@ -14,6 +14,7 @@
 #include <iomanip>
 #include <cstring>
 #include "Shell/Options.hpp"
+#include "Lib/Timer.hpp"
 
 namespace Shell {
 
@@ -37,10 +38,14 @@ const char* const TimeTrace::TERM_SHARING;
 
 TimeTrace::TimeTrace() 
   : _root("[root]")
-  , _stack({ {&_root, Clock::now(), }, }) 
+  , _stack({ {&_root, Clock::now(), 0, }, }) 
   , _enabled(false)
+  , _countInstructions(false)
 {  }
 
+long long TimeTrace::instructionsNow() const
+{ return _countInstructions ? Lib::Timer::elapsedInstructions() : 0; }
+
 TimeTrace::ScopedTimer::ScopedTimer(const char* name)
   : ScopedTimer(TimeTrace::instance(), name)
 { }
@@ -66,7 +71,7 @@ TimeTrace::ScopedTimer::ScopedTimer(TimeTrace& trace, const char* name)
     _start = start;
 #endif 
 
-    _trace._stack.push(std::make_pair(node, start));
+    _trace._stack.push(std::make_tuple(node, start, _trace.instructionsNow()));
   }
 }
 
@@ -75,14 +80,26 @@ TimeTrace TimeTrace::_instance;
 void TimeTrace::setEnabled(bool v) 
 { _enabled = v; }
 
+void TimeTrace::setCountInstructions(bool v) 
+{ 
+  // the instruction counter might not be available (e.g. in a container)
+  _countInstructions = v && Lib::Timer::elapsedInstructions() >= 0;
+  // the nodes being measured right now start counting from here
+  auto instrs = instructionsNow();
+  for (auto& x : _stack) {
+    get<2>(x) = instrs;
+  }
+}
+
 TimeTrace::ScopedTimer::~ScopedTimer()
 {
   if (_trace._enabled) {
     auto now = Clock::now();
+    auto instrs = _trace.instructionsNow();
     auto cur = _trace._stack.pop();
     auto node = get<0>(cur);
     auto start = get<1>(cur);
-    node->measurements.add(now  - start);
+    node->measurements.add(now  - start, instrs - get<2>(cur));
     ASS_EQ(node->name, _name);
     ASS(start == _start);
   }
@@ -132,6 +149,7 @@ struct TimeTrace::Node::NodeFormatOpts {
   bool last;
   bool align;
   Lib::Option<unsigned> nameWidth;
+  bool instrs;
 
   NodeFormatOpts child(Node& parent) 
   { return { .indent = this->indent, 
@@ -143,14 +161,16 @@ struct TimeTrace::Node::NodeFormatOpts {
                    .map([](auto& c) { return unsigned(strlen(c->name)); })
                    .max()
                : none<unsigned>(),
+             .instrs = this->instrs,
                }; }
 
-  static NodeFormatOpts root(decltype(indent) indent) 
+  static NodeFormatOpts root(decltype(indent) indent, bool instrs) 
   { return { .indent = indent, 
              .parentDuration = Option<Duration>(), 
              .last = true, 
              .align = false,
              .nameWidth = none<unsigned>(),
+             .instrs = instrs,
            }; }
 };
 
@@ -200,8 +220,11 @@ void TimeTrace::Node::printPrettyRec(std::ostream& out, NodeFormatOpts& opts)
 
   out << " (total: "<< msetw(4) << total
       << ", avg: "  << msetw(4) << total / cnt
-      << ", cnt: "  << msetw(6) << cnt
-      << ")" << std::endl;
+      << ", cnt: "  << msetw(6) << cnt;
+  if (opts.instrs) {
+    out << ", instrs: " << msetw(12) << measurements.instrs();
+  }
+  out << ")" << std::endl;
   std::sort(children.begin(), children.end(), [](auto& l, auto& r) { return l->totalDuration() > r->totalDuration(); });
   indent.push(indentBeforeLast);
   auto copts = opts.child(*this);
@@ -257,15 +280,16 @@ void TimeTrace::printPretty(std::ostream& out)
 {
 
   auto now = Clock::now();
+  auto instrs = instructionsNow();
   for (auto& x : _stack) {
     auto node = get<0>(x);
     auto start = get<1>(x);
-    node->measurements.add(now - start);
+    node->measurements.add(now - start, instrs - get<2>(x));
   }
 
   auto& root = _tmpRoots.size() == 0 ? _root : *_tmpRoots.top();
   Stack<const char*> indent;
-  auto rootOpts = Node::NodeFormatOpts::root(indent);
+  auto rootOpts = Node::NodeFormatOpts::root(indent, _countInstructions);
 
   out << "===== start of time trace =====" << std::endl;
   rootOpts.align = false;
@@ -283,7 +307,7 @@ void TimeTrace::printPretty(std::ostream& out)
   for (auto& x : _stack) {
     auto node = get<0>(x);
     auto start = get<1>(x);
-    node->measurements.remove(now - start);
+    node->measurements.remove(now - start, instrs - get<2>(x));
   }
 }
 
@@ -115,22 +115,28 @@ private:
   class Measurements {
     Duration _sum;
     unsigned _cnt;
+    /** (user) instructions retired, only counted if TimeTrace::_countInstructions is set */
+    long long _instrs;
 
   public:
-    void add(Duration d) {
+    void add(Duration d, long long instrs) {
       _cnt += 1;
       _sum += d;
+      _instrs += instrs;
     }
-    void remove(Duration d) {
+    void remove(Duration d, long long instrs) {
       _cnt -= 1;
       _sum -= d;
+      _instrs -= instrs;
     }
     Duration sum() const { return _sum; }
     unsigned cnt() const { return _cnt; }
     Duration avg() const { return sum() / cnt(); }
+    long long instrs() const { return _instrs; }
     void extend(Measurements other) {
       _sum += other._sum;
       _cnt += other._cnt;
+      _instrs += other._instrs;
     }
   };
 
@@ -184,12 +190,16 @@ public:
   void printPretty(std::ostream& out);
   void serialize(std::ostream& out);
   void setEnabled(bool);
+  void setCountInstructions(bool);
 private:
+  long long instructionsNow() const;
 
   Node _root;
   Lib::Stack<Node*> _tmpRoots;
-  Lib::Stack<std::tuple<Node*, TimePoint>> _stack;
+  Lib::Stack<std::tuple<Node*, TimePoint, long long>> _stack;
   bool _enabled;
+  /** whether to also count the instructions spent in each node. Costs a syscall per measurement. */
+  bool _countInstructions;
 };
 
 
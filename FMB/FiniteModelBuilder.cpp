@@ -967,8 +967,7 @@ void FiniteModelBuilder::addGroundClauses()
       cout << "Ground clause " << c->toString() << endl;
 #endif
 
-      static SATLiteralStack satClauseLits;
-      satClauseLits.reset();
+      InlineStack<SATLiteral, 16> satClauseLits;
       for(unsigned i=0;i<c->length();i++){
         unsigned f = (*c)[i]->functor();
         SATLiteral slit = getSATLiteral(f,emptyGrounding,(*c)[i]->polarity(),false);
@@ -1068,8 +1067,7 @@ instanceLabel:
       else{
         grounding[var]++;
         // Grounding represents a new instance
-        static SATLiteralStack satClauseLits;
-        satClauseLits.reset();
+        InlineStack<SATLiteral, 16> satClauseLits;
 
         if (_xmass) {
           varDistinctSortsMaxes.reset();
@@ -1248,8 +1246,7 @@ newFuncLabel:
             //Skip this instance
             goto newFuncLabel;
           }
-          static SATLiteralStack satClauseLits;
-          satClauseLits.reset();
+          InlineStack<SATLiteral, 16> satClauseLits;
 
           // grounding is of the form [y,z,x1,x2,...]
           // but use wants to be of the form use[x1,x2,...,y] and use[x1,x2,....,z]
@@ -1287,8 +1284,7 @@ void FiniteModelBuilder::addNewSymmetryOrderingAxioms(unsigned size,
 
   //cout << "Add symmetry ordering for " << gt.toString() << endl;
 
-  static SATLiteralStack satClauseLits;
-  satClauseLits.reset(); 
+  InlineStack<SATLiteral, 16> satClauseLits;
   for(unsigned i=1;i<=size;i++){
     grounding[arity]=i;
     SATLiteral sl = getSATLiteral(gt.f,grounding,true,true);
@@ -1311,8 +1307,7 @@ void FiniteModelBuilder::addNewSymmetryCanonicityAxioms(unsigned size,
   }
 
   for(unsigned i=1;i<w;i++){
-      static SATLiteralStack satClauseLits;
-      satClauseLits.reset();
+      InlineStack<SATLiteral, 16> satClauseLits;
    
       GroundedTerm gti = groundedTerms[i];
       unsigned arityi = env.signature->functionArity(gti.f);
@@ -1351,8 +1346,7 @@ void FiniteModelBuilder::addUseModelSize(unsigned size)
   // Only do thise if we have unary functions at most
   if(_maxArity>1) return;
 
-  static SATLiteralStack satClauseLits;
-  satClauseLits.reset();
+  InlineStack<SATLiteral, 16> satClauseLits;
 
   for(unsigned s=0;s<_sortedSignature->sorts;s++){ 
     Stack<GroundedTerm> groundedTerms = _sortedGroundedTerms[s];
@@ -1389,8 +1383,7 @@ void FiniteModelBuilder::addNewTotalityDefs()
       for (unsigned j = 0; j < _distinctSortSizes[i]-1; j++) {
         // for every domain size j have clause: not marker(j+1) | marker(j)
         // which says: "d > j+2" -> "d > j+1"
-        static SATLiteralStack satClauseLits;
-        satClauseLits.reset();
+        InlineStack<SATLiteral, 16> satClauseLits;
         satClauseLits.push(SATLiteral(marker_offsets[i]+j,1));
         satClauseLits.push(SATLiteral(marker_offsets[i]+j+1,0));
         SATClause* satCl = SATClause::fromStack(satClauseLits);
@@ -1417,8 +1410,7 @@ void FiniteModelBuilder::addNewTotalityDefs()
       // cout << "Totality for const " << f << " of sort " << srt << " and max size " << maxSize << endl;
 
       for (unsigned i = (!_xmass || (_sortedSignature->monotonicSorts[dsrt])) ? maxSize : 1; i <= maxSize; i++) { // just the weakest one, if monotonic
-        static SATLiteralStack satClauseLits;
-        satClauseLits.reset();
+        InlineStack<SATLiteral, 16> satClauseLits;
 
         for(unsigned constant=1;constant<=i;constant++){
           static DArray<unsigned> use(1);
@@ -1470,8 +1462,7 @@ newTotalLabel:
           //cout << endl;
 
           for (unsigned i = (!_xmass || (_sortedSignature->monotonicSorts[dRetSrt])) ? maxRtSrtSize : 1; i <= maxRtSrtSize; i++) {
-            static SATLiteralStack satClauseLits;
-            satClauseLits.reset();
+            InlineStack<SATLiteral, 16> satClauseLits;
 
             for(unsigned constant=1;constant<=i;constant++) {
               static DArray<unsigned> use;
@@ -48,6 +48,8 @@ template <typename Key, typename Val, class Hash1=DefaultHash, class Hash2=Defau
 template <typename Val, class Hash1=DefaultHash, class Hash2=DefaultHash2> class DHSet;
 template <typename Val, class Hash1=DefaultHash, class Hash2=DefaultHash2> class DHMultiset;
 template <typename Val, class Hash=DefaultHash> class Set;
+template <typename Key, typename Val, class Hash=DefaultHash> class SwissMap;
+template <typename Val, class Hash=DefaultHash> class SwissSet;
 
 class Timer;
 };
@@ -174,6 +176,7 @@ class GeneratingInferenceEngine;
 class ImmediateSimplificationEngine;
 class ForwardSimplificationEngine;
 class BackwardSimplificationEngine;
+class GlobalSubsumption;
 }
 
 namespace SAT
@@ -222,16 +222,16 @@ void ClauseCodeTree::matchCode(CodeStack& code, CodeOp* startOp, size_t& matched
 void ClauseCodeTree::remove(Clause* cl)
 {
   static DArray<LitInfo> lInfos;
-  Recycled<Stack<CodeOp*>> firstsInBlocks;
-  Recycled<Stack<Recycled<RemovingLiteralMatcher, NoReset>>> rlms;
+  InlineStack<CodeOp*, 16> firstsInBlocks;
+  InlineStack<Recycled<RemovingLiteralMatcher, NoReset>, 16> rlms;
 
   unsigned clen=cl->length();
   lInfos.ensure(clen);
 
   if(!clen) {
     CodeOp* op=getEntryPoint();
-    firstsInBlocks->push(op);
-    if(!removeOneOfAlternatives(op, cl, &*firstsInBlocks)) {
+    firstsInBlocks.push(op);
+    if(!removeOneOfAlternatives(op, cl, &firstsInBlocks)) {
       ASSERTION_VIOLATION;
       INVALID_OPERATION("empty clause to be removed was not found");
     }
@@ -245,15 +245,15 @@ void ClauseCodeTree::remove(Clause* cl)
   incTimeStamp();
 
   CodeOp* op=getEntryPoint();
-  firstsInBlocks->push(op);
+  firstsInBlocks.push(op);
   unsigned depth=0;
   for(;;) {
     RemovingLiteralMatcher* rlm = 0;
     {
       Recycled<RemovingLiteralMatcher, NoReset> rrlm; // take rlm out of recycling
       rlm = &*rrlm; // get the actual content (also to use after this initialization block)
-      rlm->init(op, lInfos.array(), lInfos.size(), this, &*firstsInBlocks); // init it
-      rlms->push(std::move(rrlm)); // store it in rlms (along with the obligation to return to recycling when no longer used)
+      rlm->init(op, lInfos.array(), lInfos.size(), this, &firstsInBlocks); // init it
+      rlms.push(std::move(rrlm)); // store it in rlms (along with the obligation to return to recycling when no longer used)
     }
 
   iteration_restart:
@@ -262,9 +262,9 @@ void ClauseCodeTree::remove(Clause* cl)
         ASSERTION_VIOLATION;
         INVALID_OPERATION("clause to be removed was not found");
       }
-      rlms->pop();
+      rlms.pop();
       depth--;
-      rlm = &*rlms->top();
+      rlm = &*rlms.top();
       goto iteration_restart;
     }
 
@@ -280,7 +280,7 @@ void ClauseCodeTree::remove(Clause* cl)
 
     op++;
     if(depth==clen-1) {
-      if(removeOneOfAlternatives(op, cl, &*firstsInBlocks)) {
+      if(removeOneOfAlternatives(op, cl, &firstsInBlocks)) {
         //successfully removed
         break;
       }
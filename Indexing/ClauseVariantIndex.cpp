@@ -514,5 +514,143 @@ unsigned HashingClauseVariantIndex::computeHash(Literal* const * lits, unsigned
   return hash;
 }
 
+//-------------------//-------------------//-------------------//-------------------
+//-------------------//-------------------//-------------------//-------------------
+
+ClauseVariantFilter::ClauseVariantFilter()
+: _size(0), _purgeLimit(1024)
+{
+  _bloom.init(_purgeLimit/2, 0);
+}
+
+ClauseVariantFilter::~ClauseVariantFilter()
+{
+  DHMap<unsigned, ClauseList*>::Iterator iit(_entries);
+  while(iit.hasNext()) {
+    ClauseList* lst = iit.next();
+    ClauseList::Iterator cit(lst);
+    while(cit.hasNext()) {
+      cit.next()->decRefCnt();
+    }
+    ClauseList::destroy(lst);
+  }
+}
+
+bool ClauseVariantFilter::isKept(Clause* cl)
+{
+  return cl->store() == Clause::PASSIVE || cl->store() == Clause::SELECTED || cl->store() == Clause::ACTIVE;
+}
+
+/**
+ * Each hash sets two bits, one given by its lower and one by its (rotated) upper half
+ */
+bool ClauseVariantFilter::bloomContains(unsigned hash) const
+{
+  size_t mask = _bloom.size()*64-1;
+  size_t b1 = hash & mask;
+  size_t b2 = ((hash >> 16) | (hash << 16)) & mask;
+  return (_bloom[b1/64] >> (b1%64) & 1) && (_bloom[b2/64] >> (b2%64) & 1);
+}
+
+void ClauseVariantFilter::bloomAdd(unsigned hash)
+{
+  size_t mask = _bloom.size()*64-1;
+  size_t b1 = hash & mask;
+  size_t b2 = ((hash >> 16) | (hash << 16)) & mask;
+  _bloom[b1/64] |= uint64_t(1) << (b1%64);
+  _bloom[b2/64] |= uint64_t(1) << (b2%64);
+}
+
+void ClauseVariantFilter::insert(Clause* cl)
+{
+  TIME_TRACE("variant filter insert");
+
+  unsigned h = HashingClauseVariantIndex::computeHash(cl->literals(),cl->length());
+
+  ClauseList** lst;
+  _entries.getValuePtr(h,lst);
+  // a clause may come back to the containers, e.g. when reintroduced by the splitter
+  if (ClauseList::member(cl, *lst)) {
+    return;
+  }
+  ClauseList::push(cl, *lst);
+  cl->incRefCnt();
+  _size++;
+  bloomAdd(h);
+}
+
+/**
+ * Remove from @b lst the clauses that are no longer kept and release them
+ */
+void ClauseVariantFilter::purge(ClauseList*& lst)
+{
+  ClauseList::DelIterator it(lst);
+  while(it.hasNext()) {
+    Clause* cl = it.next();
+    if (!isKept(cl)) {
+      it.del();
+      _size--;
+      cl->decRefCnt();
+    }
+  }
+}
+
+void ClauseVariantFilter::purgeAll()
+{
+  TIME_TRACE("variant filter purge");
+
+  DHMap<unsigned, ClauseList*>::DelIterator iit(_entries);
+  while(iit.hasNext()) {
+    ClauseList* lst = iit.next();
+    purge(lst);
+    if (lst) {
+      iit.setValue(lst);
+    } else {
+      iit.del();
+    }
+  }
+
+  _purgeLimit = max(1024u, 2*_size);
+  // at least 32 bits per clause the index may hold before the next purge
+  size_t words = 1;
+  while (words*2 < _purgeLimit) {
+    words *= 2;
+  }
+  _bloom.init(words, 0);
+  DHMap<unsigned, ClauseList*>::Iterator hit(_entries);
+  while(hit.hasNext()) {
+    bloomAdd(hit.nextKey());
+  }
+}
+
+ClauseIterator ClauseVariantFilter::retrieveVariants(Literal* const * lits, unsigned length)
+{
+  TIME_TRACE("variant filter retrieve");
+
+  if (_size >= _purgeLimit) {
+    purgeAll();
+  }
+
+  unsigned h = HashingClauseVariantIndex::computeHash(lits,length);
+  if (!bloomContains(h)) {
+    return ClauseIterator::getEmpty();
+  }
+
+  ClauseList** lst = _entries.findPtr(h);
+  if (!lst) {
+    return ClauseIterator::getEmpty();
+  }
+  purge(*lst);
+  if (!*lst) {
+    _entries.remove(h);
+    return ClauseIterator::getEmpty();
+  }
+
+  return pvi( getFilteredIterator(
+      getMappingIterator(
+        ClauseList::Iterator(*lst),
+        ResultClauseToVariantClauseFn(lits, length)),
+      NonzeroFn()) );
+}
 
 }
@@ -19,6 +19,7 @@
 #include "Forwards.hpp"
 
 #include "Lib/Array.hpp"
+#include "Lib/DArray.hpp"
 #include "Lib/List.hpp"
 #include "Lib/DHMap.hpp"
 
@@ -86,18 +87,21 @@ public:
 
   ClauseIterator retrieveVariants(Literal* const * lits, unsigned length) override;
 
+  /** A hash of the clause @b lits of length @b length which is invariant under variable renaming and literal order */
+  static unsigned computeHash(Literal* const * lits, unsigned length);
+
 private:
   struct VariableIgnoringComparator;
 
   typedef DHMap<unsigned, unsigned char> VarCounts; // overflows allowed
 
-  unsigned termFunctorHash(Term* t, unsigned hash_begin) {
+  static unsigned termFunctorHash(Term* t, unsigned hash_begin) {
     unsigned func = t->functor();
     // std::cout << "will hash funtor " << func << std::endl;
     return DefaultHash::hash(func, hash_begin);
   }
 
-  unsigned computeHashAndCountVariables(unsigned var, VarCounts& varCnts, unsigned hash_begin) {
+  static unsigned computeHashAndCountVariables(unsigned var, VarCounts& varCnts, unsigned hash_begin) {
     const unsigned varHash = 1u;
 
     unsigned char* pcnt;
@@ -111,12 +115,55 @@ private:
     return DefaultHash::hash(varHash, hash_begin);
   }
 
-  unsigned computeHashAndCountVariables(TermList* tl, VarCounts& varCnts, unsigned hash_begin);
-  unsigned computeHashAndCountVariables(Literal* l, VarCounts& varCnts, unsigned hash_begin);
+  static unsigned computeHashAndCountVariables(TermList* tl, VarCounts& varCnts, unsigned hash_begin);
+  static unsigned computeHashAndCountVariables(Literal* l, VarCounts& varCnts, unsigned hash_begin);
+
+  DHMap<unsigned, ClauseList*> _entries;
+};
+
+/**
+ * Variant index for recognising new clauses which are variants of clauses
+ * already kept (passive, selected or active) by the saturation algorithm.
+ *
+ * Clauses are bucketed by the hash of HashingClauseVariantIndex::computeHash
+ * and a Bloom filter over these hashes answers most queries, namely those
+ * with no variant around, without looking into the table.
+ *
+ * The index holds a reference to each inserted clause. Clauses which have
+ * left the containers in the meantime are released lazily, either when their
+ * bucket is retrieved or in a purge of the whole index once the number of
+ * entries doubles since the previous purge.
+ */
+class ClauseVariantFilter : public ClauseVariantIndex
+{
+public:
+  CLASS_NAME(ClauseVariantFilter);
+  USE_ALLOCATOR(ClauseVariantFilter);
+
+  ClauseVariantFilter();
+  virtual ~ClauseVariantFilter() override;
+
+  virtual void insert(Clause* cl) override;
+
+  using ClauseVariantIndex::retrieveVariants;
+  ClauseIterator retrieveVariants(Literal* const * lits, unsigned length) override;
+
+private:
+  static bool isKept(Clause* cl);
+
+  bool bloomContains(unsigned hash) const;
+  void bloomAdd(unsigned hash);
 
-  unsigned computeHash(Literal* const * lits, unsigned length);
+  void purge(ClauseList*& lst);
+  void purgeAll();
 
   DHMap<unsigned, ClauseList*> _entries;
+  /** bits of the Bloom filter, the number of words is a power of two */
+  DArray<uint64_t> _bloom;
+  /** number of clauses in @b _entries */
+  unsigned _size;
+  /** when @b _size reaches this, the released clauses are purged and the Bloom filter rebuilt */
+  unsigned _purgeLimit;
 };
 
 };
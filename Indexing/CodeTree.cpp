@@ -1378,6 +1378,74 @@ bool CodeTree::Matcher::execute()
   }
 
 
+#if defined(__GNUC__)
+  // Direct-threaded dispatch (labels as values): each handler jumps straight
+  // to the handler of the next operation, indexed by CodeOp::dispatchIndex(),
+  // instead of going through the nested prefix/suffix switch below.
+  static void* const handlers[16] = {
+    &&successOrFail, &&checkGroundTerm, &&litEnd, &&checkFun,
+    &&successOrFail, &&checkGroundTerm, &&litEnd, &&assignVar,
+    &&successOrFail, &&checkGroundTerm, &&litEnd, &&checkVar,
+    &&successOrFail, &&checkGroundTerm, &&litEnd, &&searchStruct,
+  };
+
+#define CODE_TREE_DISPATCH                                \
+  if(op->alternative()) {                                 \
+    btStack.push(BTPoint(tp, op->alternative()));         \
+  }                                                       \
+  goto *handlers[op->dispatchIndex()];
+
+  //the SEARCH_STRUCT operation does not appear in CodeBlocks and
+  //in each CodeBlock there is always either operation LIT_END or FAIL,
+  //so we may safely increase the operation pointer
+#define CODE_TREE_NEXT                                    \
+  ASS(!op->isSearchStruct());                             \
+  op++;                                                   \
+  CODE_TREE_DISPATCH
+
+  CODE_TREE_DISPATCH
+
+successOrFail:
+  //yield successes only in the first round (we don't want to yield the
+  //same thing for each query literal)
+  if(op->isFail() || curLInfo!=0) {
+    goto fail;
+  }
+  return true;
+litEnd:
+  return true;
+checkGroundTerm:
+  if(!doCheckGroundTerm()) {
+    goto fail;
+  }
+  CODE_TREE_NEXT
+checkFun:
+  if(!doCheckFun()) {
+    goto fail;
+  }
+  CODE_TREE_NEXT
+assignVar:
+  doAssignVar();
+  CODE_TREE_NEXT
+checkVar:
+  if(!doCheckVar()) {
+    goto fail;
+  }
+  CODE_TREE_NEXT
+searchStruct:
+  if(doSearchStruct()) {
+    //a new value of @b op is assigned
+    CODE_TREE_DISPATCH
+  }
+fail:
+  if(!backtrack()) {
+    return false;
+  }
+  CODE_TREE_DISPATCH
+
+#undef CODE_TREE_NEXT
+#undef CODE_TREE_DISPATCH
+#else
   bool shouldBacktrack=false;
   for(;;) {
     if(op->alternative()) {
@@ -1441,6 +1509,7 @@ bool CodeTree::Matcher::execute()
       op++;
     }
   }
+#endif
 }
 
 /**
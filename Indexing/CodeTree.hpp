@@ -222,6 +222,13 @@ public:
       ASS_EQ(instrPrefix(), SUFFIX_INSTR);
       return static_cast<InstructionSuffix>(_info.suffix);
     }
+    /**
+     * Prefix and suffix bits as a single number in 0..15, for single-level
+     * dispatch in @b Matcher::execute(). Unless the prefix is SUFFIX_INSTR,
+     * the suffix bits belong to the stored pointer and are arbitrary,
+     * so a dispatch table must map all four such values to the same handler.
+     */
+    inline unsigned dispatchIndex() const { return _info.prefix | (_info.suffix << 2); }
 
     inline unsigned arg() const { return _info.arg; }
     inline CodeOp* alternative() const { return _alternative; }
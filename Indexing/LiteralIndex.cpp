@@ -70,6 +70,11 @@ size_t LiteralIndex::getUnificationCount(Literal* lit, bool complementary)
   return _is->getUnificationCount(lit, complementary);
 }
 
+size_t LiteralIndex::estimateUnificationCount(Literal* lit, bool complementary, unsigned budget)
+{
+  return _is->estimateUnificationCount(lit, complementary, budget);
+}
+
 void LiteralIndex::handleLiteral(Literal* lit, Clause* cl, bool add)
 {
   if(add) {
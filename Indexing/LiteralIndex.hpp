@@ -48,6 +48,8 @@ public:
 
   size_t getUnificationCount(Literal* lit, bool complementary);
 
+  size_t estimateUnificationCount(Literal* lit, bool complementary, unsigned budget);
+
 
 protected:
   LiteralIndex(LiteralIndexingStructure* is) : _is(is) {}
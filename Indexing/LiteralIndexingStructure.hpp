@@ -45,6 +45,15 @@ public:
     return countIteratorElements(getUnifications(lit, complementary, false));
   }
 
+  /**
+   * An upper bound on getUnificationCount() that costs at most about
+   * @b budget steps; structures that cannot estimate count exactly.
+   */
+  virtual size_t estimateUnificationCount(Literal* lit, bool complementary, unsigned budget)
+  {
+    return getUnificationCount(lit, complementary);
+  }
+
 #if VDEBUG
   virtual void markTagged() = 0;
 #endif
@@ -52,6 +52,16 @@ SLQueryResultIterator LiteralSubstitutionTree::getVariants(Literal* query, bool
         .map([](QueryResult qr) { return SLQueryResult(qr.data->literal, qr.data->clause, qr.subst, qr.constr); }));
 }
 
+size_t LiteralSubstitutionTree::estimateUnificationCount(Literal* lit, bool complementary, unsigned budget)
+{
+  auto& tree = getTree(lit, complementary);
+  size_t res = tree.estimateUnifications(lit, /* reversed */ false, budget);
+  if (lit->commutative()) {
+    res += tree.estimateUnifications(lit, /* reversed */ true, budget);
+  }
+  return res;
+}
+
 SLQueryResultIterator LiteralSubstitutionTree::getAll()
 {
   return pvi(
@@ -59,6 +59,8 @@ public:
 
   SLQueryResultIterator getVariants(Literal* lit, bool complementary, bool retrieveSubstitutions) override;
 
+  size_t estimateUnificationCount(Literal* lit, bool complementary, unsigned budget) override;
+
 
 #if VDEBUG
   virtual void markTagged() override { }
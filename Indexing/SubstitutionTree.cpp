@@ -150,6 +150,7 @@ void SubstitutionTree::insert(BindingMap& svBindings, LeafData ld)
     ASS((*pnode)->isLeaf());
     ensureLeafEfficiency(reinterpret_cast<Leaf**>(pnode));
     static_cast<Leaf*>(*pnode)->insert(ld);
+    (*pnode)->entries++;
     DEBUG_INSERT("out: ", *this);
     return;
   }
@@ -212,6 +213,7 @@ start:
 
       Node* node=*pnode;
       IntermediateNode* newNode = createIntermediateNode(node->term, urr.var,_useC);
+      newNode->entries=node->entries;
       node->term=urr.original;
 
       *pnode=newNode;
@@ -226,6 +228,8 @@ start:
 
   IntermediateNode* inode = static_cast<IntermediateNode*>(*pnode);
   ASS(inode);
+  //the new entry ends up below inode in any case
+  inode->entries++;
 
   unsigned boundVar=inode->childVar;
   TermList term=svBindings.get(boundVar);
@@ -249,6 +253,7 @@ start:
     while (!remainingBindings.isEmpty()) {
       Binding b=remainingBindings.pop();
       IntermediateNode* inode = createIntermediateNode(term, b.var,_useC);
+      inode->entries=1;
       term=b.term;
 
       *pnode = inode;
@@ -257,6 +262,7 @@ start:
     Leaf* lnode=createLeaf(term);
     *pnode=lnode;
     lnode->insert(ld);
+    lnode->entries=1;
 
     ensureIntermediateNodeEfficiency(reinterpret_cast<IntermediateNode**>(pparent));
     DEBUG_INSERT("out: ", *this);
@@ -333,6 +339,7 @@ start:
     ensureLeafEfficiency(reinterpret_cast<Leaf**>(pnode));
     Leaf* leaf = static_cast<Leaf*>(*pnode);
     leaf->insert(ld);
+    leaf->entries++;
     DEBUG_INSERT("out: ", *this);
     return;
   }
@@ -357,8 +364,7 @@ void SubstitutionTree::remove(BindingMap& svBindings, LeafData ld)
 
   ASS(*pnode);
 
-  static Stack<Node**> history(1000);
-  history.reset();
+  InlineStack<Node**, 32> history;
 
   while (! (*pnode)->isLeaf()) {
     history.push(pnode);
@@ -422,6 +428,10 @@ void SubstitutionTree::remove(BindingMap& svBindings, LeafData ld)
 
   Leaf* lnode = static_cast<Leaf*>(*pnode);
   lnode->remove(ld);
+  lnode->entries--;
+  for(Node** h : history) {
+    (*h)->entries--;
+  }
   ensureLeafEfficiency(reinterpret_cast<Leaf**>(pnode));
 
   while( (*pnode)->isEmpty() ) {
@@ -513,6 +523,78 @@ SubstitutionTree::Leaf* SubstitutionTree::findLeaf(Node* root, BindingMap& svBin
 }
 
 
+/**
+ * Bind the special variables in @b node (a term stored in the tree) to the
+ * corresponding subterms of @b query, pushing them to @b bound. Special variables
+ * opposite a variable of the query are left unbound, i.e. matching anything.
+ * Return false if a top symbol of @b node clashes with the one of @b query.
+ */
+static bool estimateMatch(TermList node, TermList query, DArray<TermList>& bindings, Stack<unsigned>& bound)
+{
+  if(query.isEmpty() || query.isVar()) {
+    return true;
+  }
+  if(node.isSpecialVar()) {
+    if(node.var()<bindings.size()) {
+      bindings[node.var()]=query;
+      bound.push(node.var());
+    }
+    return true;
+  }
+  if(node.isVar()) {
+    return true;
+  }
+  Term* n=node.term();
+  Term* q=query.term();
+  if(n->functor()!=q->functor() || n->arity()!=q->arity()) {
+    return false;
+  }
+  for(unsigned i=0;i<n->arity();i++) {
+    if(!estimateMatch(*n->nthArgument(i), *q->nthArgument(i), bindings, bound)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Estimate the number of entries below @b node that unify with the query
+ * whose subterms are bound to the special variables in @b bindings.
+ * Each intermediate node entered costs one unit of @b budget; when it runs
+ * out, the entries of the remaining subtrees are counted without descending.
+ */
+unsigned SubstitutionTree::estimateUnifications(Node* node, DArray<TermList>& bindings, unsigned& budget)
+{
+  if(node->isLeaf() || budget==0) {
+    return node->entries;
+  }
+  budget--;
+
+  IntermediateNode* inode=static_cast<IntermediateNode*>(node);
+  TermList query=bindings[inode->childVar];
+  NodeIterator children;
+  if(query.isEmpty() || query.isVar()) {
+    children=inode->allChildren();
+  } else {
+    Node** match=inode->childByTop(query, false);
+    children=match ? pvi(getConcatenatedIterator(getSingletonIterator(match), inode->variableChildren()))
+                   : inode->variableChildren();
+  }
+
+  unsigned res=0;
+  InlineStack<unsigned, 8> bound;
+  while(children.hasNext()) {
+    Node* child=*children.next();
+    if(estimateMatch(child->term, query, bindings, bound)) {
+      res+=estimateUnifications(child, bindings, budget);
+    }
+    while(bound.isNonEmpty()) {
+      bindings[bound.pop()].makeEmpty();
+    }
+  }
+  return res;
+}
+
 #if VDEBUG
 
 vstring getIndentStr(int n)
@@ -539,6 +621,7 @@ void SubstitutionTree::Node::split(Node** pnode, TermList* where, int var)
   Node* node=*pnode;
 
   IntermediateNode* newNode = createIntermediateNode(node->term, var,node->withSorts());
+  newNode->entries=node->entries;
   node->term=*where;
   *pnode=newNode;
 
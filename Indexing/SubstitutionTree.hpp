@@ -32,6 +32,7 @@
 #include "Lib/Backtrackable.hpp"
 #include "Lib/ArrayMap.hpp"
 #include "Lib/Array.hpp"
+#include "Lib/DArray.hpp"
 #include "Lib/BiMap.hpp"
 #include "Lib/Recycled.hpp"
 
@@ -193,6 +194,21 @@ public:
       : pvi(iterTraits(Iterator(this, _root, query, retrieveSubstitutions, reversed, withConstraints, _functionalSubtermMap.asPtr() )));
   }
 
+  /**
+   * Same as @b iterator, but returns the retrieval iterator itself, so that callers
+   * can wrap it further without an extra VirtualIterator in between.
+   * Must not be called when the tree is empty (see @b hasRoot).
+   */
+  template<class Iterator, class TermOrLit> 
+  Iterator staticIterator(TermOrLit query, bool retrieveSubstitutions, bool withConstraints, bool reversed = false)
+  {
+    ASS(hasRoot())
+    return Iterator(this, _root, query, retrieveSubstitutions, reversed, withConstraints, _functionalSubtermMap.asPtr() );
+  }
+
+  /** false if nothing was ever inserted, i.e. retrievals will never return anything */
+  bool hasRoot() const { return _root != nullptr; }
+
   class LDComparator
   {
   public:
@@ -252,9 +268,9 @@ public:
     friend std::ostream& operator<<(std::ostream& out, Node const& self) 
     { self.output(out, /* multiline = */ false, /* indent */ 0); return out; }
     inline
-    Node() { term.makeEmpty(); }
+    Node() : entries(0) { term.makeEmpty(); }
     inline
-    Node(TermList ts) : term(ts) { }
+    Node(TermList ts) : term(ts), entries(0) { }
     virtual ~Node();
     /** True if a leaf node */
     virtual bool isLeaf() const = 0;
@@ -284,6 +300,12 @@ public:
 
     /** term at this node */
     TermList term;
+    /**
+     * Number of entries in the leaves below this node (in the node itself, if it is a leaf).
+     * Maintained by SubstitutionTree::insert and SubstitutionTree::remove, so that the
+     * size of a subtree can be read without traversing it.
+     */
+    unsigned entries;
 
     virtual void output(std::ostream& out, bool multiline, int indent) const = 0;
   };
@@ -739,6 +761,8 @@ public:
 
   Leaf* findLeaf(Node* root, BindingMap& svBindings);
 
+  static unsigned estimateUnifications(Node* node, DArray<TermList>& bindings, unsigned& budget);
+
   void setSort(TypedTermList const& term, LeafData& ld)
   {
     ASS_EQ(ld.term, term)
@@ -829,6 +853,32 @@ public:
     { out << "{ _query: " << _query << ", _result: " << _result << " }"; }
   };
 
+  /**
+   * Estimate the number of entries unifying with @b query, visiting at most
+   * @b budget intermediate nodes. Only the top symbols of the query are compared
+   * with those in the tree (no occurs check, repeated variables are ignored)
+   * and once the budget is spent whole subtrees are counted, so the result is
+   * an upper bound on the number of unifiers.
+   */
+  template<class Query>
+  unsigned estimateUnifications(Query query, bool reversed, unsigned budget)
+  {
+    if (_root == nullptr) {
+      return 0;
+    }
+    DArray<TermList> bindings(_nextVar);
+    for (unsigned i = 0; i < bindings.size(); i++) {
+      bindings[i].makeEmpty();
+    }
+    createBindings(query, reversed,
+        [&](unsigned var, TermList t) {
+          if (var < bindings.size()) {
+            bindings[var] = t;
+          }
+        });
+    return estimateUnifications(_root, bindings, budget);
+  }
+
   template<class Query>
   bool generalizationExists(Query query)
   {
@@ -202,6 +202,7 @@ SubstitutionTree::IntermediateNode* SubstitutionTree::SListIntermediateNode
     res = new SListIntermediateNode(orig->term, orig->childVar);
   }
   res->loadChildren(orig->allChildren());
+  res->entries=orig->entries;
   orig->makeEmpty();
   delete orig;
   return res;
@@ -215,6 +216,7 @@ SubstitutionTree::SListLeaf* SubstitutionTree::SListLeaf::assimilate(Leaf* orig)
 {
   SListLeaf* res=new SListLeaf(orig->term);
   res->loadChildren(orig->allChildren());
+  res->entries=orig->entries;
   orig->makeEmpty();
   delete orig;
   return res;
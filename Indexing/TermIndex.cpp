@@ -51,6 +51,9 @@ TermQueryResultIterator TermIndex::getGeneralizations(TypedTermList t, bool retr
 TermQueryResultIterator TermIndex::getInstances(TypedTermList t, bool retrieveSubstitutions)
 { return _is->getInstances(t, retrieveSubstitutions); }
 
+size_t TermIndex::estimateUnificationCount(TypedTermList t, unsigned budget)
+{ return _is->estimateUnificationCount(t, budget); }
+
 void SuperpositionSubtermIndex::handleClause(Clause* c, bool adding)
 {
   TIME_TRACE("backward superposition index maintenance");
@@ -37,6 +37,8 @@ public:
   TermQueryResultIterator getGeneralizations(TypedTermList t, bool retrieveSubstitutions = true);
   TermQueryResultIterator getInstances(TypedTermList t, bool retrieveSubstitutions = true);
 
+  size_t estimateUnificationCount(TypedTermList t, unsigned budget);
+
 protected:
   TermIndex(TermIndexingStructure* is) : _is(is) {}
 
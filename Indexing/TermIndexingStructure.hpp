@@ -37,6 +37,15 @@ public:
 
   virtual bool generalizationExists(TermList t) { NOT_IMPLEMENTED; }
 
+  /**
+   * An upper bound on the number of unifiers of @b t that costs at most about
+   * @b budget steps; structures that cannot estimate count exactly.
+   */
+  virtual size_t estimateUnificationCount(TypedTermList t, unsigned budget)
+  {
+    return countIteratorElements(getUnifications(t, /* retrieveSubstitutions */ false));
+  }
+
 #if VDEBUG
   virtual void markTagged() = 0;
 #endif
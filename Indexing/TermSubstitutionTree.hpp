@@ -83,14 +83,21 @@ private:
   void handleTerm(TypedTermList tt, LeafData ld, bool insert)
   { SubstitutionTree::handle(tt, ld, insert); }
 
+  /**
+   * Retrieval iterator wrapped into a single VirtualIterator
+   * (going through SubstitutionTree::iterator would add a second one per query)
+   */
   template<class Iterator> 
-  auto getResultIterator(TypedTermList query, bool retrieveSubstitutions, bool withConstraints)
+  TermQueryResultIterator getResultIterator(TypedTermList query, bool retrieveSubstitutions, bool withConstraints)
   { 
-    return iterTraits(SubstitutionTree::iterator<Iterator>(query, retrieveSubstitutions, withConstraints))
+    if (!SubstitutionTree::hasRoot()) {
+      return TermQueryResultIterator::getEmpty();
+    }
+    return pvi(iterTraits(SubstitutionTree::staticIterator<Iterator>(query, retrieveSubstitutions, withConstraints))
       .map([this](QueryResult qr) 
         { return TermQueryResult(
             _extra ? qr.data->extraTerm : qr.data->term,
-            qr.data->literal, qr.data->clause, qr.subst, qr.constr); }) ; 
+            qr.data->literal, qr.data->clause, qr.subst, qr.constr); })); 
   }
 
   //higher-order concerns
@@ -102,13 +109,16 @@ private:
   { return out << multiline((SubstitutionTree const&) self.self); }
 public:
   TermQueryResultIterator getInstances(TypedTermList t, bool retrieveSubstitutions) override
-  { return pvi(getResultIterator<FastInstancesIterator>(t, retrieveSubstitutions, /* constraints */ false)); }
+  { return getResultIterator<FastInstancesIterator>(t, retrieveSubstitutions, /* constraints */ false); }
 
   TermQueryResultIterator getGeneralizations(TypedTermList t, bool retrieveSubstitutions) override
-  { return pvi(getResultIterator<FastGeneralizationsIterator>(t, retrieveSubstitutions, /* constraints */ false)); }
+  { return getResultIterator<FastGeneralizationsIterator>(t, retrieveSubstitutions, /* constraints */ false); }
 
   TermQueryResultIterator getUnifications(TypedTermList t, bool retrieveSubstitutions, bool withConstraints) override
-  { return pvi(getResultIterator<UnificationsIterator>(t, retrieveSubstitutions, withConstraints)); }
+  { return getResultIterator<UnificationsIterator>(t, retrieveSubstitutions, withConstraints); }
+
+  size_t estimateUnificationCount(TypedTermList t, unsigned budget) override
+  { return SubstitutionTree::estimateUnifications(t, /* reversed */ false, budget); }
 
 };
 
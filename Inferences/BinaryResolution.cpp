@@ -182,9 +182,13 @@ Clause* BinaryResolution::generateClause(Clause* queryCl, Literal* queryLit, SLQ
   Clause* res = new(newLength) Clause(newLength, inf); // the inference object owned by res from now on
 
   Literal* queryLitAfter = 0;
+  unsigned queryLitPos = 0;
   if (ord && queryCl->numSelected() > 1) {
     TIME_TRACE(TimeTrace::LITERAL_ORDER_AFTERCHECK);
     queryLitAfter = qr.substitution->applyToQuery(queryLit);
+    if (queryCl->hasSelectedLiteralOrder()) {
+      queryLitPos = queryCl->getLiteralPosition(queryLit);
+    }
   }
 #if VDEBUG
 /*
@@ -247,7 +251,15 @@ Clause* BinaryResolution::generateClause(Clause* queryCl, Literal* queryLit, SLQ
       if (queryLitAfter && i < queryCl->numSelected()) {
         TIME_TRACE(TimeTrace::LITERAL_ORDER_AFTERCHECK);
 
-        Ordering::Result o = ord->compare(newLit,queryLitAfter);
+        // the order cached at activation carries over to the instances
+        Ordering::Result o;
+        if (queryCl->selectedLiteralGreater(i, queryLitPos)) {
+          o = Ordering::GREATER;
+        } else if (queryCl->selectedLiteralGreater(queryLitPos, i)) {
+          o = Ordering::LESS;
+        } else {
+          o = ord->compare(newLit,queryLitAfter);
+        }
 
         if (o == Ordering::GREATER ||
             (ls->isPositiveForSelection(newLit)    // strict maximimality for positive literals
@@ -264,9 +276,13 @@ Clause* BinaryResolution::generateClause(Clause* queryCl, Literal* queryLit, SLQ
   }
 
   Literal* qrLitAfter = 0;
+  unsigned qrLitPos = 0;
   if (ord && qr.clause->numSelected() > 1) {
     TIME_TRACE(TimeTrace::LITERAL_ORDER_AFTERCHECK);
     qrLitAfter = qr.substitution->applyToResult(qr.literal);
+    if (qr.clause->hasSelectedLiteralOrder()) {
+      qrLitPos = qr.clause->getLiteralPosition(qr.literal);
+    }
   }
 
   for(unsigned i=0;i<dlength;i++) {
@@ -285,7 +301,14 @@ Clause* BinaryResolution::generateClause(Clause* queryCl, Literal* queryLit, SLQ
       if (qrLitAfter && i < qr.clause->numSelected()) {
         TIME_TRACE(TimeTrace::LITERAL_ORDER_AFTERCHECK);
 
-        Ordering::Result o = ord->compare(newLit,qrLitAfter);
+        Ordering::Result o;
+        if (qr.clause->selectedLiteralGreater(i, qrLitPos)) {
+          o = Ordering::GREATER;
+        } else if (qr.clause->selectedLiteralGreater(qrLitPos, i)) {
+          o = Ordering::LESS;
+        } else {
+          o = ord->compare(newLit,qrLitAfter);
+        }
 
         if (o == Ordering::GREATER ||
             (ls->isPositiveForSelection(newLit)   // strict maximimality for positive literals
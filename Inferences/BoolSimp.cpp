@@ -66,7 +66,7 @@ substitution:
 
 bool BoolSimp::areComplements(TermList t1, TermList t2){
   Signature::Symbol* sym;
-  static TermStack args;
+  InlineStack<TermList, 8> args;
   TermList head;
 
   ApplicativeHelper::getHeadAndArgs(t1, head, args);
@@ -102,7 +102,7 @@ TermList BoolSimp::negate(TermList term){
 TermList BoolSimp::boolSimplify(TermList term){
   static TermList troo(Term::foolTrue());
   static TermList fols(Term::foolFalse());
-  static TermStack args;
+  InlineStack<TermList, 8> args;
   TermList head;
 
   ApplicativeHelper::getHeadAndArgs(term, head, args);
@@ -49,7 +49,7 @@ typedef ApplicativeHelper AH;
   TermList troo = TermList(Term::foolTrue());
   TermList fols = TermList(Term::foolFalse());
 
-  static TermStack args;
+  InlineStack<TermList, 8> args;
   TermList head;
  
   for(int i = c->length()-1; i>=0; i--){
@@ -91,7 +91,7 @@ Clause* EqualsProxyISE::simplify(Clause* c){
   TermList troo = TermList(Term::foolTrue());
   TermList fols = TermList(Term::foolFalse());
 
-  static TermStack args;
+  InlineStack<TermList, 8> args;
   TermList head;
  
   for(int i = c->length()-1; i >=0; i--){
@@ -133,7 +133,7 @@ Clause* PiSigmaProxyISE::simplify(Clause* c){
   TermList troo = TermList(Term::foolTrue());
   TermList fols = TermList(Term::foolFalse());
 
-  static TermStack args;
+  InlineStack<TermList, 8> args;
   TermList head;
  
   for(int i = c->length() - 1 ; i >= 0; i--){
@@ -186,7 +186,7 @@ Clause* OrImpAndProxyISE::simplify(Clause* c){
   TermList troo = TermList(Term::foolTrue());
   TermList fols = TermList(Term::foolFalse());
 
-  static TermStack args;
+  InlineStack<TermList, 8> args;
   TermList head;
  
   for(int i = c->length() -1; i >=0; i--){
@@ -252,7 +252,7 @@ ClauseIterator ProxyISE::simplifyMany(Clause* c){
   TermList fols = TermList(Term::foolFalse());
   TermList boolSort = AtomicSort::boolSort();
 
-  static TermStack args;
+  InlineStack<TermList, 8> args;
   TermList head;
  
   ClauseStack resultStack;
@@ -411,7 +411,7 @@ ClauseIterator produceClauses(Clause* c, bool generating, SkolemisingFormulaInde
   TermList fols = TermList(Term::foolFalse());
   TermList boolSort = AtomicSort::boolSort();
 
-  static TermStack args;
+  InlineStack<TermList, 8> args;
   TermList head;
  
   ClauseStack resultStack;
@@ -694,7 +694,7 @@ TermList piRemoval(TermList piTerm, Clause* clause, TermList expsrt){
 Clause* IFFXORRewriterISE::simplify(Clause* c){
   TermList boolSort = AtomicSort::boolSort();
 
-  static TermStack args;
+  InlineStack<TermList, 8> args;
   TermList head;
  
   for(unsigned i = 0; i < c->length(); i++){
@@ -28,10 +28,8 @@ Clause* DistinctEqualitySimplifier::simplify(Clause* cl)
   if(!canSimplify(cl)) {
     return cl;
   }
-  static LiteralStack lits;
-  static Stack<Unit*> prems;
-  prems.reset();
-  lits.reset();
+  InlineStack<Literal*, 16> lits;
+  InlineStack<Unit*, 8> prems;
   unsigned clen = cl->length();
   for(unsigned i=0; i<clen; i++) {
     Literal* lit = (*cl)[i];
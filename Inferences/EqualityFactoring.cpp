@@ -98,9 +98,8 @@ struct EqualityFactoring::ResultFn
     TermList srt = SortHelper::getEqualityArgumentSort(sLit);
 
     static RobSubstitution subst;
-    static UnificationConstraintStack constraints;
+    InlineStack<UnificationConstraint, 4> constraints;
     subst.reset();
-    constraints.reset();
 
     if (!subst.unify(srt, 0, SortHelper::getEqualityArgumentSort(fLit), 0)) {
       return 0;
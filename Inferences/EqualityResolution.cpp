@@ -98,9 +98,8 @@ struct EqualityResolution::ResultFn
     }
 
     static RobSubstitution subst;
-    static UnificationConstraintStack constraints;
+    InlineStack<UnificationConstraint, 4> constraints;
     subst.reset();
-    constraints.reset();
     subst.setMap(&funcSubtermMap);
 
     if(use_uwa_handler){
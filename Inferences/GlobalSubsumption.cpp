@@ -64,6 +64,13 @@ void GlobalSubsumption::attach(SaturationAlgorithm* salg)
   }
 }
 
+GlobalSubsumption::~GlobalSubsumption()
+{
+  while (!_deferredClauses.isEmpty()) {
+    _deferredClauses.pop_front()->decRefCnt();
+  }
+}
+
 void GlobalSubsumption::detach()
 {
   _index=0;
@@ -92,13 +99,11 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
   Grounder& grounder = _index->getGrounder();
   
   // SAT literals of the prop. abstraction of cl
-  static SATLiteralStack plits;
-  plits.reset();
+  InlineStack<SATLiteral, 16> plits;
   
   // assumptions corresponding to the negation of the new prop clause
   // (and perhaps additional ones used to "activate" AVATAR-conditional clauses)
-  static SATLiteralStack assumps;
-  assumps.reset();
+  InlineStack<SATLiteral, 16> assumps;
   
   // lookup to retrieve the FO lits later back
   static DHMap<SATLiteral,Literal*> lookup;
@@ -171,8 +176,7 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
       // proper subset sufficed for UNSAT - that's the interesting case
       const SATLiteralStack& failedFinal = _explicitMinim ? solver.explicitlyMinimizedFailedAssumptions(_uprOnly,_randomizeMinim) : failed;
 
-      static LiteralStack survivors;
-      survivors.reset();
+      InlineStack<Literal*, 16> survivors;
 
       static Set<SATLiteral> splitAssumps;
       splitAssumps.reset();
@@ -268,6 +272,11 @@ struct GlobalSubsumption::Unit2ClFn
 
 bool GlobalSubsumption::perform(Clause* cl, Clause*& replacement, ClauseIterator& premises)
 {
+  if (_deferred) {
+    // the saturation algorithm queues the clause once it makes it to passive
+    return false;
+  }
+
   static Stack<Unit*> prems;
   
   Clause* newCl = perform(cl,prems);
@@ -16,6 +16,7 @@
 #define __GlobalSubsumption__
 
 #include "Forwards.hpp"
+#include "Lib/Deque.hpp"
 #include "Indexing/GroundingIndex.hpp"
 #include "Shell/Options.hpp"
 
@@ -43,7 +44,9 @@ public:
       _explicitMinim(opts.globalSubsumptionExplicitMinim()!=Options::GlobalSubsumptionExplicitMinim::OFF),
       _randomizeMinim(opts.globalSubsumptionExplicitMinim()==Options::GlobalSubsumptionExplicitMinim::RANDOMIZED),
       _splittingAssumps(opts.globalSubsumptionAvatarAssumptions()!= Options::GlobalSubsumptionAvatarAssumptions::OFF),
+      _deferred(opts.globalSubsumptionDeferred()!=0),
       _splitter(0) {}
+  ~GlobalSubsumption();
 
   /**
    * The attach function must not be called when this constructor is used.
@@ -55,6 +58,23 @@ public:
   bool perform(Clause* cl, Clause*& replacement, ClauseIterator& premises) override;
   
   Clause* perform(Clause* cl, Stack<Unit*>& prems);
+
+  /**
+   * In the deferred mode (see --global_subsumption_deferred), the forward
+   * simplification does nothing. Instead, the saturation algorithm queues
+   * clauses added to passive, later pops them and reduces them (if possible)
+   * by @b perform, removing them from the containers as in a backward simplification.
+   *
+   * The queue holds a reference to each queued clause, which the caller of
+   * popDeferred becomes responsible for.
+   */
+  void addDeferred(Clause* cl)
+  {
+    cl->incRefCnt();
+    _deferredClauses.push_back(cl);
+  }
+  Clause* popDeferred() { return _deferredClauses.pop_front(); }
+  bool hasDeferred() const { return !_deferredClauses.isEmpty(); }
  
 private:  
   struct Unit2ClFn;
@@ -81,6 +101,12 @@ private:
    */
   bool _splittingAssumps;
 
+  /**
+   * Leave the reductions to the saturation algorithm, see @b addDeferred
+   */
+  bool _deferred;
+  Deque<Clause*> _deferredClauses;
+
   /*
    * GS needs a splitter when FULL_MODEL value is specified for the interaction with AVATAR.
    * 
@@ -23,6 +23,7 @@
 #include "Lib/PairUtils.hpp"
 #include "Lib/Set.hpp"
 
+#include "Kernel/FormulaTransformer.hpp"
 #include "Kernel/FormulaUnit.hpp"
 #include "Kernel/RobSubstitution.hpp"
 #include "Kernel/TermIterators.hpp"
@@ -261,7 +262,8 @@ void Induction::detach() {
 ClauseIterator Induction::generateClauses(Clause* premise)
 {
   return pvi(InductionClauseIterator(premise, InductionHelper(_comparisonIndex, _inductionTermIndex), getOptions(),
-    _structInductionTermIndex, _formulaIndex));
+    _structInductionTermIndex, _formulaIndex,
+    getOptions().inductionClausificationCache() ? &_clausificationCache : nullptr));
 }
 
 void InductionClauseIterator::processClause(Clause* premise)
@@ -585,10 +587,284 @@ void InductionClauseIterator::processIntegerComparison(Clause* premise, Literal*
   }
 }
 
-ClauseStack InductionClauseIterator::produceClauses(Formula* hypothesis, InferenceRule rule, const InductionContext& context)
+namespace {
+
+/**
+ * Replaces the maximal ground subterms of a formula by free variables numbered
+ * from FIRST_VAR (equal subterms by the same variable), collecting the subterms.
+ * Boolean subterms are kept, as the clausifier treats them specially.
+ */
+class GroundTermAbstraction
+: public TermTransformer
+{
+public:
+  static const unsigned FIRST_VAR = 1u << 24;
+
+  TermStack terms;
+
+  /**
+   * Compute the key of @b f in the clausification cache into @b res.
+   * Return false if @b f contains FOOL terms and cannot be cached.
+   */
+  bool key(Formula* f, InductionClausificationCache::Key& res)
+  {
+    AbstractingFormulaTransformer ft(*this);
+    Formula* abstracted = ft.transform(f);
+    if (ft.unsupported) {
+      return false;
+    }
+    addToKey(abstracted, res);
+    for (const auto& t : terms) {
+      addToKey(SortHelper::getResultSort(t.term()), res);
+    }
+    return true;
+  }
+
+protected:
+  TermList transformSubterm(TermList trm) override
+  {
+    if (trm.isVar() || !trm.term()->shared() || !trm.term()->ground() || trm.term()->isSort() ||
+        SortHelper::getResultSort(trm.term()) == AtomicSort::boolSort()) {
+      return trm;
+    }
+    unsigned i = 0;
+    while (i < terms.size() && terms[i] != trm) {
+      i++;
+    }
+    if (i == terms.size()) {
+      terms.push(trm);
+    }
+    return TermList(FIRST_VAR + i, false);
+  }
+
+private:
+  static void addToKey(TermList sort, InductionClausificationCache::Key& res)
+  {
+    if (sort.isVar()) {
+      res.first.push(0);
+      res.first.push(sort.var());
+    } else {
+      res.first.push(1);
+      res.second.push(sort.term());
+    }
+  }
+
+  static void addToKey(Formula* f, InductionClausificationCache::Key& res)
+  {
+    res.first.push(f->connective());
+    switch (f->connective()) {
+      case LITERAL:
+        res.second.push(f->literal());
+        return;
+      case AND:
+      case OR: {
+        res.first.push(FormulaList::length(f->args()));
+        FormulaList::Iterator it(f->args());
+        while (it.hasNext()) {
+          addToKey(it.next(), res);
+        }
+        return;
+      }
+      case IMP:
+      case IFF:
+      case XOR:
+        addToKey(f->left(), res);
+        addToKey(f->right(), res);
+        return;
+      case NOT:
+        addToKey(f->uarg(), res);
+        return;
+      case FORALL:
+      case EXISTS: {
+        res.first.push(VList::length(f->vars()));
+        VList::Iterator vit(f->vars());
+        while (vit.hasNext()) {
+          res.first.push(vit.next());
+        }
+        res.first.push(SList::length(f->sorts()));
+        SList::Iterator sit(f->sorts());
+        while (sit.hasNext()) {
+          addToKey(sit.next(), res);
+        }
+        addToKey(f->qarg(), res);
+        return;
+      }
+      case TRUE:
+      case FALSE:
+        return;
+      default:
+        ASSERTION_VIOLATION;
+    }
+  }
+
+  class AbstractingFormulaTransformer
+  : public TermTransformingFormulaTransformer
+  {
+  public:
+    AbstractingFormulaTransformer(TermTransformer& termTransformer)
+      : TermTransformingFormulaTransformer(termTransformer) {}
+
+    bool unsupported = false;
+
+  protected:
+    bool preApply(Formula*& f) override
+    {
+      if (f->connective() == BOOL_TERM || (f->connective() == LITERAL && !f->literal()->shared())) {
+        unsupported = true;
+        return false;
+      }
+      return true;
+    }
+  };
+};
+
+/**
+ * Instantiates cached clauses: replaces the abstracted subterms of the cached
+ * formula by those of the new one, and the Skolem symbols of the cached
+ * clausification by their fresh copies.
+ */
+class CachedClauseInstantiation
+: public TermTransformer
 {
+public:
+  CachedClauseInstantiation(const TermStack& from, const TermStack& to,
+      const DHMap<unsigned, unsigned>& functions, const DHMap<unsigned, unsigned>& predicates)
+    : _from(from), _to(to), _functions(functions), _predicates(predicates) {}
+
+  Literal* instantiate(Literal* lit)
+  {
+    Literal* res = transform(lit);
+    unsigned pred;
+    if (!_predicates.find(res->functor(), pred)) {
+      return res;
+    }
+    InlineStack<TermList, 8> args;
+    for (unsigned i = 0; i < res->arity(); i++) {
+      args.push(*res->nthArgument(i));
+    }
+    return Literal::create(pred, res->arity(), res->polarity(), false, args.begin());
+  }
+
+protected:
+  TermList transformSubterm(TermList trm) override
+  {
+    if (trm.isVar()) {
+      return trm;
+    }
+    for (unsigned i = 0; i < _from.size(); i++) {
+      if (_from[i] == trm) {
+        return _to[i];
+      }
+    }
+    Term* t = trm.term();
+    unsigned fn;
+    if (t->isSort() || !_functions.find(t->functor(), fn)) {
+      return trm;
+    }
+    InlineStack<TermList, 8> args;
+    for (unsigned i = 0; i < t->arity(); i++) {
+      TermList arg = *t->nthArgument(i);
+      TermList inst = transformSubterm(arg);
+      args.push(inst != arg ? inst : transform(arg));
+    }
+    return TermList(Term::create(fn, t->arity(), args.begin()));
+  }
+
+private:
+  const TermStack& _from;
+  const TermStack& _to;
+  const DHMap<unsigned, unsigned>& _functions;
+  const DHMap<unsigned, unsigned>& _predicates;
+};
+
+/** Add a fresh Skolem symbol of the same type and with the same markings as @b sym */
+unsigned copySkolemSymbol(Signature::Symbol* sym, bool predicate)
+{
+  unsigned res = predicate ? env.signature->addSkolemPredicate(sym->arity())
+                           : env.signature->addSkolemFunction(sym->arity());
+  Signature::Symbol* copy = predicate ? env.signature->getPredicate(res) : env.signature->getFunction(res);
+  copy->setType(predicate ? sym->predType() : sym->fnType());
+  if (sym->inGoal()) {
+    copy->markInGoal();
+  }
+  if (sym->inductionSkolem()) {
+    copy->markInductionSkolem();
+  }
+  return res;
+}
+
+} // namespace
+
+ClauseStack InductionClausificationCache::clausify(FormulaUnit* fu)
+{
+  GroundTermAbstraction abstraction;
+  Key key;
+  bool supported = abstraction.key(fu->formula(), key);
+  // the ENNF step is recorded in the proof whether the clauses are cached or not
+  FormulaUnit* ennf = NNF::ennf(fu);
+
+  Entry* e = nullptr;
+  if (supported && _entries.size() >= MAX_ENTRIES && !_entries.find(key)) {
+    _entries.reset();
+  }
+  if (supported && !_entries.getValuePtr(key, e)) {
+    // the formula is an instance of a cached one
+    DHMap<unsigned, unsigned> functions;
+    DHMap<unsigned, unsigned> predicates;
+    for (unsigned f : e->functions) {
+      functions.insert(f, copySkolemSymbol(env.signature->getFunction(f), false));
+    }
+    for (unsigned p : e->predicates) {
+      predicates.insert(p, copySkolemSymbol(env.signature->getPredicate(p), true));
+    }
+    env.statistics->skolemFunctions += e->functions.size() + e->predicates.size();
+    CachedClauseInstantiation inst(e->terms, abstraction.terms, functions, predicates);
+    ClauseStack res;
+    for (const auto& lits : e->clauses) {
+      InlineStack<Literal*, 16> instLits;
+      for (Literal* lit : lits) {
+        instLits.push(inst.instantiate(lit));
+      }
+      res.push(Clause::fromStack(instLits, FormulaTransformation(InferenceRule::CLAUSIFY, ennf)));
+    }
+    return res;
+  }
+
+  unsigned functions = env.signature->functions();
+  unsigned predicates = env.signature->predicates();
+  unsigned typeCons = env.signature->typeCons();
+
+  ClauseStack res;
   NewCNF cnf(0);
   cnf.setForInduction();
+  cnf.clausify(ennf, res);
+
+  if (!e) {
+    return res;
+  }
+  // only Skolem functions and predicates can be replaced by fresh copies
+  bool cacheable = env.signature->typeCons() == typeCons;
+  for (unsigned f = functions; f < env.signature->functions(); f++) {
+    cacheable &= env.signature->getFunction(f)->skolem();
+    e->functions.push(f);
+  }
+  for (unsigned p = predicates; p < env.signature->predicates(); p++) {
+    cacheable &= env.signature->getPredicate(p)->skolem();
+    e->predicates.push(p);
+  }
+  if (!cacheable) {
+    _entries.remove(key);
+    return res;
+  }
+  e->terms = std::move(abstraction.terms);
+  for (Clause* cl : res) {
+    e->clauses.push(LiteralStack::fromIterator(cl->iterLits()));
+  }
+  return res;
+}
+
+ClauseStack InductionClauseIterator::produceClauses(Formula* hypothesis, InferenceRule rule, const InductionContext& context)
+{
   Stack<Clause*> hyp_clauses;
   Inference inf = NonspecificInference0(UnitInputType::AXIOM,rule);
   unsigned maxInductionDepth = 0;
@@ -602,7 +878,13 @@ ClauseStack InductionClauseIterator::produceClauses(Formula* hypothesis, Inferen
     env.out() << "[Induction] formula " << fu->toString() << endl;
     env.endOutput();
   }
-  cnf.clausify(NNF::ennf(fu), hyp_clauses);
+  if (_clausificationCache) {
+    hyp_clauses = _clausificationCache->clausify(fu);
+  } else {
+    NewCNF cnf(0);
+    cnf.setForInduction();
+    cnf.clausify(NNF::ennf(fu), hyp_clauses);
+  }
 
   switch (rule) {
     case InferenceRule::STRUCT_INDUCTION_AXIOM:
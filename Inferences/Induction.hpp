@@ -148,6 +148,42 @@ private:
   bool _ready;
 };
 
+/**
+ * Clausified induction formulas, keyed by the formula with its maximal ground
+ * subterms abstracted away. A formula that differs from a cached one only in
+ * these subterms (e.g. the Skolem constants of the induction literals) is not
+ * clausified again: the cached clauses are instantiated with its subterms and
+ * with fresh copies of the Skolem symbols introduced by the clausification.
+ * Once the cache holds MAX_ENTRIES formulas, it is flushed as a whole.
+ */
+class InductionClausificationCache
+{
+public:
+  CLASS_NAME(InductionClausificationCache);
+  USE_ALLOCATOR(InductionClausificationCache);
+
+  static const unsigned MAX_ENTRIES = 1024;
+
+  /**
+   * The connectives and bound variables of an abstracted formula, followed by
+   * its shared literals and the sorts of its bound variables and abstracted subterms.
+   */
+  using Key = std::pair<Stack<unsigned>, Stack<Term*>>;
+
+  ClauseStack clausify(FormulaUnit* fu);
+
+private:
+  struct Entry {
+    /** the abstracted subterms of the clausified formula */
+    TermStack terms;
+    Stack<LiteralStack> clauses;
+    /** Skolem symbols introduced when clausifying the formula */
+    Stack<unsigned> functions;
+    Stack<unsigned> predicates;
+  };
+  DHMap<Key, Entry> _entries;
+};
+
 class Induction
 : public GeneratingInferenceEngine
 {
@@ -174,6 +210,7 @@ private:
   TermIndex* _inductionTermIndex = nullptr;
   TermIndex* _structInductionTermIndex = nullptr;
   InductionFormulaIndex _formulaIndex;
+  InductionClausificationCache _clausificationCache;
 };
 
 class InductionClauseIterator
@@ -181,9 +218,10 @@ class InductionClauseIterator
 public:
   // all the work happens in the constructor!
   InductionClauseIterator(Clause* premise, InductionHelper helper, const Options& opt,
-    TermIndex* structInductionTermIndex, InductionFormulaIndex& formulaIndex)
+    TermIndex* structInductionTermIndex, InductionFormulaIndex& formulaIndex,
+    InductionClausificationCache* clausificationCache = nullptr)
       : _helper(helper), _opt(opt), _structInductionTermIndex(structInductionTermIndex),
-      _formulaIndex(formulaIndex)
+      _formulaIndex(formulaIndex), _clausificationCache(clausificationCache)
   {
     processClause(premise);
   }
@@ -221,6 +259,8 @@ private:
   const Options& _opt;
   TermIndex* _structInductionTermIndex;
   InductionFormulaIndex& _formulaIndex;
+  // null if induction formulas are clausified from scratch
+  InductionClausificationCache* _clausificationCache;
 };
 
 };
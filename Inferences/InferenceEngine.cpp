@@ -334,8 +334,7 @@ Clause* DuplicateLiteralRemovalISE::simplify(Clause* c)
 
   //literals that will be skipped, skipping starts on the top of the stack
   //and goes from the end of the clause
-  static LiteralStack skipped;
-  skipped.reset();
+  InlineStack<Literal*, 16> skipped;
 
   //we handle low length specially, not to have to use the set
   if(length==2) {
@@ -421,11 +420,9 @@ Clause* TautologyDeletionISE2::simplify(Clause* c)
 {
   typedef ApplicativeHelper AH;
 
-  static LiteralStack negLits;
-  static LiteralStack posLits;
+  InlineStack<Literal*, 16> negLits;
+  InlineStack<Literal*, 16> posLits;
 
-  negLits.reset();
-  posLits.reset();
 
   for(unsigned i = 0; i < c->length(); i++){
     Literal* lit = (*c)[i];
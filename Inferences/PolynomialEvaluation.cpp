@@ -230,7 +230,7 @@ Option<PolyNf> PolynomialEvaluation::evaluate(PolyNf normalized) const
       );
     }
   };
-  static Memo::Hashed<PolyNf, PolyNf, StlHash> memo;
+  static Memo::Bounded<PolyNf, PolyNf, StlHash> memo(Memo::BOUNDED_CAPACITY);
   auto out = evaluateBottomUp(normalized, Eval{ *this }, memo);
   if (out == normalized) {
     return Option<PolyNf>();
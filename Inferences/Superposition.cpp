@@ -143,10 +143,10 @@ ClauseIterator Superposition::generateClauses(Clause* premise)
   auto itb1 = premise->getSelectedLiteralIterator();
   auto itb2 = getMapAndFlattenIterator(itb1,EqHelper::SuperpositionLHSIteratorFn(_salg->getOrdering(), _salg->getOptions()));
   auto itb3 = getMapAndFlattenIterator(itb2, 
-      [this] (pair<Literal*, TermList> arg)
+      [this] (pair<Literal*, TypedTermList> arg)
       { return pushPairIntoRightIterator(
-              arg, 
-              _subtermIndex->getUnifications(TypedTermList(arg.second, SortHelper::getEqualityArgumentSort(arg.first)), 
+              pair<Literal*, TermList>(arg.first, arg.second),
+              _subtermIndex->getUnifications(arg.second,
                 /* retrieveSubstitutions */ true, withConstraints)); });
 
   //Perform backward superposition
@@ -488,9 +488,13 @@ Clause* Superposition::performSuperposition(
 
   {
     Literal* eqLitS = 0;
+    unsigned eqLitPos = 0;
     if (afterCheck && eqClause->numSelected() > 1) {
       TIME_TRACE(TimeTrace::LITERAL_ORDER_AFTERCHECK);
       eqLitS = Literal::createEquality(true,eqLHSS,tgtTermS,eqLHSsort);
+      if (eqClause->hasSelectedLiteralOrder()) {
+        eqLitPos = eqClause->getLiteralPosition(eqLit);
+      }
     }
 
     for(unsigned i=0;i<eqLength;i++) {
@@ -513,7 +517,15 @@ Clause* Superposition::performSuperposition(
         if (eqLitS && i < eqClause->numSelected()) {
           TIME_TRACE(TimeTrace::LITERAL_ORDER_AFTERCHECK);
 
-          Ordering::Result o = ordering.compare(currAfter,eqLitS);
+          // eqLitS is the instance of eqLit, so the order cached at activation carries over
+          Ordering::Result o;
+          if (eqClause->selectedLiteralGreater(i, eqLitPos)) {
+            o = Ordering::GREATER;
+          } else if (eqClause->selectedLiteralGreater(eqLitPos, i)) {
+            o = Ordering::LESS;
+          } else {
+            o = ordering.compare(currAfter,eqLitS);
+          }
 
           if (o == Ordering::GREATER || o == Ordering::GREATER_EQ || o == Ordering::EQUAL) { // where is GREATER_EQ ever coming from?
             env.statistics->inferencesBlockedForOrderingAftercheck++;
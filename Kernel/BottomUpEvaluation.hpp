@@ -67,6 +67,48 @@ namespace Memo {
     }
   };
 
+  /** capacity of the static Bounded memos of the arithmetic normalization */
+  constexpr unsigned BOUNDED_CAPACITY = 1 << 16;
+
+  /**
+   * a memoization realized as a hashmap that holds at most @b capacity entries.
+   * Once it is full it is flushed as a whole, which makes it suitable as a static
+   * memo that is reused across many calls without growing without bound.
+   */
+  template<class Arg, class Result, class Hash = DefaultHash>
+  class Bounded
+  {
+    Map<Arg, Result, Hash> _memo;
+    unsigned _capacity;
+
+    void flushIfFull()
+    {
+      if (unsigned(_memo.size()) >= _capacity) {
+        Map<Arg, Result, Hash> fresh;
+        std::swap(_memo, fresh);
+      }
+    }
+
+  public:
+    explicit Bounded(unsigned capacity) : _memo(decltype(_memo)()), _capacity(capacity) {}
+
+    template<class Init> Result getOrInit(Arg const& orig, Init init)
+    {
+      flushIfFull();
+      return _memo.getOrInit(Arg(orig), init);
+    }
+
+    Option<Result> get(const Arg& orig)
+    {
+      auto out = _memo.getPtr(orig);
+      if (out) {
+        return Option<Result>(*out);
+      } else {
+        return Option<Result>();
+      }
+    }
+  };
+
 } // namespace Memo
 
 /**
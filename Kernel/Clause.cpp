@@ -34,6 +34,7 @@
 #include "Shell/Options.hpp"
 
 #include "Inference.hpp"
+#include "Ordering.hpp"
 #include "Signature.hpp"
 #include "Term.hpp"
 #include "TermIterators.hpp"
@@ -54,6 +55,7 @@ using namespace Saturation;
 using namespace Shell;
 
 size_t Clause::_auxCurrTimestamp = 0;
+const unsigned Clause::MAX_ORDERED_SELECTED;
 #if VDEBUG
 bool Clause::_auxInUse = false;
 #endif
@@ -74,6 +76,7 @@ Clause::Clause(unsigned length,const Inference& inf)
     _refCnt(0),
     _reductionTimestamp(0),
     _literalPositions(0),
+    _selectedGreater(0),
     _numActiveSplits(0),
     _auxTimestamp(0)
 {
@@ -122,6 +125,7 @@ void Clause::destroyExceptInferenceObject()
   if (_literalPositions) {
     delete _literalPositions;
   }
+  discardSelectedLiteralOrder();
 
   RSTAT_CTR_INC("clauses deleted");
 
@@ -711,6 +715,52 @@ void Clause::notifyLiteralReorder()
   if (_literalPositions) {
     _literalPositions->update(_literals);
   }
+  discardSelectedLiteralOrder();
+}
+
+void Clause::discardSelectedLiteralOrder()
+{
+  if (_selectedGreater) {
+    unsigned cnt = orderedSelected();
+    DEALLOC_KNOWN(_selectedGreater, cnt*sizeof(unsigned), "Clause::selectedGreater");
+    _selectedGreater = 0;
+  }
+}
+
+/**
+ * Compare the selected literals pairwise by @b ord once, so that the literal
+ * order aftercheck of generating inferences with this clause can skip
+ * comparing instances of literals whose order is already known.
+ *
+ * Should be called after the literal selection, only clauses with more
+ * than one selected literal get the order cached.
+ */
+void Clause::computeSelectedLiteralOrder(const Ordering& ord)
+{
+  ASS(!_selectedGreater);
+
+  unsigned cnt = orderedSelected();
+  if (cnt < 2) {
+    return;
+  }
+  _selectedGreater = static_cast<unsigned*>(ALLOC_KNOWN(cnt*sizeof(unsigned), "Clause::selectedGreater"));
+  for (unsigned i = 0; i < cnt; i++) {
+    _selectedGreater[i] = 0;
+  }
+  for (unsigned i = 0; i < cnt; i++) {
+    for (unsigned j = i+1; j < cnt; j++) {
+      switch (ord.compare(_literals[i], _literals[j])) {
+      case Ordering::GREATER:
+        _selectedGreater[i] |= 1u << j;
+        break;
+      case Ordering::LESS:
+        _selectedGreater[j] |= 1u << i;
+        break;
+      default:
+        break;
+      }
+    }
+  }
 }
 
 #if VDEBUG
@@ -145,6 +145,7 @@ public:
   {
     ASS(s >= 0);
     ASS(s <= _length);
+    discardSelectedLiteralOrder();
     _numSelected = s;
     notifyLiteralReorder();
   }
@@ -201,6 +202,27 @@ public:
   unsigned getLiteralPosition(Literal* lit);
   void notifyLiteralReorder();
 
+  /** Selected literals beyond this many are not covered by the selected literal order */
+  static const unsigned MAX_ORDERED_SELECTED = 32;
+
+  void computeSelectedLiteralOrder(const Ordering& ord);
+  bool hasSelectedLiteralOrder() const { return _selectedGreater; }
+  /**
+   * True if the @b i-th selected literal was found greater than the @b j-th one
+   * by computeSelectedLiteralOrder. Orderings are stable under substitutions,
+   * so the same holds for the literals in any instance of the clause.
+   */
+  bool selectedLiteralGreater(unsigned i, unsigned j) const
+  {
+    ASS_L(i, numSelected());
+    ASS_L(j, numSelected());
+    unsigned cnt = orderedSelected();
+    return _selectedGreater && i < cnt && j < cnt && ((_selectedGreater[i] >> j) & 1);
+  }
+  /** Number of selected literals covered by the selected literal order */
+  unsigned orderedSelected() const
+  { return _numSelected < MAX_ORDERED_SELECTED ? _numSelected : MAX_ORDERED_SELECTED; }
+
   bool shouldBeDestroyed();
   void destroyIfUnnecessary();
 
@@ -381,6 +403,13 @@ protected:
   unsigned _reductionTimestamp;
   /** a map that translates Literal* to its index in the clause */
   InverseLookup<Literal>* _literalPositions;
+  /**
+   * Bitmaps of the ordering among the selected literals, bit j of the i-th one
+   * set iff the i-th selected literal is greater than the j-th one.
+   * Computed by computeSelectedLiteralOrder, discarded when literals get reordered.
+   */
+  unsigned* _selectedGreater;
+  void discardSelectedLiteralOrder();
 
   int _numActiveSplits;
 
@@ -276,42 +276,10 @@ VirtualIterator<ELEMENT_TYPE(SubtermIterator)> EqHelper::getRewritableSubtermIte
  */
 VirtualIterator<TypedTermList> EqHelper::getLHSIterator(Literal* lit, const Ordering& ord)
 {
-  if (lit->isEquality()) {
-    if (lit->isNegative()) {
-      return withEqualitySort(lit,TermIterator::getEmpty());
-    }
-    TermList t0=*lit->nthArgument(0);
-    TermList t1=*lit->nthArgument(1);
-    switch(ord.getEqualityArgumentOrder(lit))
-    {
-    case Ordering::INCOMPARABLE:
-      return withEqualitySort(lit, getConcatenatedIterator(getSingletonIterator(t0),
-	      getSingletonIterator(t1)) );
-    case Ordering::GREATER:
-    case Ordering::GREATER_EQ:
-      return withEqualitySort(lit, getSingletonIterator(t0) );
-    case Ordering::LESS:
-    case Ordering::LESS_EQ:
-      return withEqualitySort(lit, getSingletonIterator(t1) );
-    //there should be no equality literals of equal terms
-    case Ordering::EQUAL:
-      ASSERTION_VIOLATION;
-    }
-    return withEqualitySort(lit,TermIterator::getEmpty());
-  } else {
-    return withEqualitySort(lit,TermIterator::getEmpty());
-  }
+  return pvi( iterTraits(LHSPairIterator(lit, ord, /* nonVariableOnly */ false))
+      .map([](std::pair<Literal*, TypedTermList> p) { return p.second; }) );
 }
 
-/**
- * A functor that returns true iff its argument is a non-variable term
- */
-struct EqHelper::IsNonVariable
-{
-  bool operator()(TermList t)
-  { return t.isTerm(); }
-};
-
 /**
  * Return iterator on sides of the equality @b lit that can be used as an LHS
  * for superposition
@@ -320,15 +288,50 @@ struct EqHelper::IsNonVariable
  */
 VirtualIterator<TypedTermList> EqHelper::getSuperpositionLHSIterator(Literal* lit, const Ordering& ord, const Options& opt)
 {
-  if (opt.superpositionFromVariables()) {
-    return getLHSIterator(lit, ord);
+  return pvi( iterTraits(SuperpositionLHSIteratorFn(ord, opt)(lit))
+      .map([](std::pair<Literal*, TypedTermList> p) { return p.second; }) );
+}
+
+EqHelper::LHSPairIterator::LHSPairIterator(Literal* lit, const Ordering& ord, bool nonVariableOnly)
+  : _lit(lit), _cnt(0), _next(0)
+{
+  if (!lit->isEquality() || lit->isNegative()) {
+    return;
   }
-  else {
-    return pvi( getFilteredIterator(getLHSIterator(lit, ord), IsNonVariable()) );
+  _sort = SortHelper::getEqualityArgumentSort(lit);
+
+  TermList t0=*lit->nthArgument(0);
+  TermList t1=*lit->nthArgument(1);
+  auto add = [&](TermList t) {
+    if (!nonVariableOnly || t.isTerm()) {
+      _sides[_cnt++] = t;
+    }
+  };
+
+  switch(ord.getEqualityArgumentOrder(lit))
+  {
+  case Ordering::INCOMPARABLE:
+    add(t0);
+    add(t1);
+    break;
+  case Ordering::GREATER:
+  case Ordering::GREATER_EQ:
+    add(t0);
+    break;
+  case Ordering::LESS:
+  case Ordering::LESS_EQ:
+    add(t1);
+    break;
+  //there should be no equality literals of equal terms
+  case Ordering::EQUAL:
+    ASSERTION_VIOLATION;
   }
 }
 
-
+EqHelper::LHSPairIterator EqHelper::SuperpositionLHSIteratorFn::operator()(Literal* lit)
+{
+  return LHSPairIterator(lit, _ord, /* nonVariableOnly */ !_opt.superpositionFromVariables());
+}
 
 VirtualIterator<TypedTermList> EqHelper::getSubVarSupLHSIterator(Literal* lit, const Ordering& ord)
 {
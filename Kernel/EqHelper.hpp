@@ -51,13 +51,41 @@ public:
   static Term* replace(Term* t, TermList what, TermList by);
   static Literal* replace(Literal* lit, TermList what, TermList by);
 
+
+  /**
+   * Iterator over the sides of @b lit that can be used as an LHS (see @b getLHSIterator),
+   * each paired with @b lit. If @b nonVariableOnly, variable sides are skipped.
+   *
+   * There are at most two such sides, so they are kept in place and the iterator needs no allocation.
+   */
+  class LHSPairIterator
+  {
+  public:
+    DECL_ELEMENT_TYPE(std::pair<Literal*, TypedTermList>);
+
+    LHSPairIterator(Literal* lit, const Ordering& ord, bool nonVariableOnly);
+
+    bool hasNext() { return _next < _cnt; }
+    std::pair<Literal*, TypedTermList> next()
+    {
+      ASS(hasNext());
+      return std::make_pair(_lit, TypedTermList(_sides[_next++], _sort));
+    }
+  private:
+    Literal* _lit;
+    TermList _sides[2];
+    TermList _sort;
+    unsigned _cnt;
+    unsigned _next;
+  };
+
   struct LHSIteratorFn
   {
     LHSIteratorFn(const Ordering& ord) : _ord(ord) {}
 
-    VirtualIterator<std::pair<Literal*, TypedTermList> > operator()(Literal* lit)
+    LHSPairIterator operator()(Literal* lit)
     {
-      return pvi( pushPairIntoRightIterator(lit, getLHSIterator(lit, _ord)) );
+      return LHSPairIterator(lit, _ord, /* nonVariableOnly */ false);
     }
   private:
     const Ordering& _ord;
@@ -67,10 +95,7 @@ public:
   {
     SuperpositionLHSIteratorFn(const Ordering& ord, const Options& opt) : _ord(ord), _opt(opt) {}
 
-    VirtualIterator<std::pair<Literal*, TypedTermList> > operator()(Literal* lit)
-    {
-      return pvi( pushPairIntoRightIterator(lit, getSuperpositionLHSIterator(lit, _ord, _opt)) );
-    }
+    LHSPairIterator operator()(Literal* lit);
   private:
     const Ordering& _ord;
     const Options& _opt;
@@ -106,8 +131,6 @@ private:
   template<class SubtermIterator>
   static VirtualIterator<ELEMENT_TYPE(SubtermIterator)> getRewritableSubtermIterator(Literal* lit, const Ordering& ord);
 
-  struct IsNonVariable;
-
 };
 
 };
@@ -20,6 +20,7 @@
 #include <cstdlib>
 
 #include "Lib/Allocator.hpp"
+#include "Lib/Reflection.hpp"
 #include "Lib/VString.hpp"
 #include "Forwards.hpp"
 
@@ -779,6 +780,21 @@ public:
   bool hasNext(Iterator& it) const;
   Unit* next(Iterator& it) const;
 
+  /**
+   * Iterator over the premises of an inference in the usual hasNext()/next() style.
+   * The premises are traversed in place, so the inference must outlive the iterator.
+   */
+  class PremiseIterator {
+  public:
+    DECL_ELEMENT_TYPE(Unit*);
+    PremiseIterator(const Inference& inf) : _inf(inf), _it(inf.iterator()) {}
+    bool hasNext() { return _inf.hasNext(_it); }
+    Unit* next() { return _inf.next(_it); }
+  private:
+    const Inference& _inf;
+    Iterator _it;
+  };
+
   /*
   * The supporting heap allocated objects are deleted
   * (The unitList of INFERENCE_MANY and, additionally,
@@ -115,7 +115,6 @@ UnitIterator InferenceStore::getParents(Unit* us, InferenceRule& rule)
   ASS_NEQ(us,0);
 
   // The unit itself stores the inference
-  UnitList* res = 0;
   Inference& inf = us->inference();
 
   // opportunity to shrink the premise list
@@ -123,14 +122,10 @@ UnitIterator InferenceStore::getParents(Unit* us, InferenceRule& rule)
   // and the solver didn't provide a proper proof nor a core)
   inf.minimizePremises();
 
-  Inference::Iterator iit = inf.iterator();
-  while(inf.hasNext(iit)) {
-    Unit* premUnit = inf.next(iit);
-    UnitList::push(premUnit, res);
-  }
   rule = inf.rule();
-  res = UnitList::reverse(res); //we want items in the same order
-  return pvi(UnitList::DestructiveIterator(res));
+  // traverse the premises in place rather than copying them,
+  // proof printing asks for the parents of every step (sometimes more than once)
+  return pvi(Inference::PremiseIterator(inf));
 }
 
 /**
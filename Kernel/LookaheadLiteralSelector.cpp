@@ -40,137 +40,61 @@ using namespace Indexing;
 using namespace Saturation;
 
 /**
- * Iterator that yields the same number of elements as there are inferences
- * that can be performed with a clause that has the literal passed to
- * the constructor selected
+ * Estimate the number of inferences that can be performed with a clause
+ * that has @b lit selected: binary resolutions, backward and forward
+ * superpositions and equality resolution. The unifiers are not enumerated,
+ * the indices only give upper bounds on their number (see
+ * SubstitutionTree::estimateUnifications), so the cost is bounded
+ * by ESTIMATE_BUDGET per index query.
  */
-struct LookaheadLiteralSelector::GenIteratorIterator
+size_t LookaheadLiteralSelector::estimateInferenceCount(Literal* lit)
 {
-  DECL_ELEMENT_TYPE(VirtualIterator<void>);
-
-  GenIteratorIterator(Literal* lit, LookaheadLiteralSelector& parent) : stage(0), lit(lit), prepared(false), _parent(parent) {}
+  SaturationAlgorithm* salg=SaturationAlgorithm::tryGetInstance();
+  if(!salg) {
+    static bool errAnnounced = false;
+    if(!errAnnounced) {
+      errAnnounced = true;
+      env.beginOutput();
+      env.out()<<"Using LookaheadLiteralSelector without having an SaturationAlgorithm object\n";
+      env.endOutput();
+    }
+    //we are too early, there's no saturation algorithm and therefore no generating inferences
+    return 0;
+  }
 
-  bool hasNext()
-  {
-    if(prepared) {
-      return true;
-    }
+  IndexManager* imgr=salg->getIndexManager();
+  ASS(imgr);
+  size_t res=0;
 
-    SaturationAlgorithm* salg=SaturationAlgorithm::tryGetInstance();
-    if(!salg) {
-      static bool errAnnounced = false;
-      if(!errAnnounced) {
-	errAnnounced = true;
-	env.beginOutput();
-	env.out()<<"Using LookaheadLiteralSelector without having an SaturationAlgorithm object\n";
-	env.endOutput();
-      }
-      //we are too early, there's no saturation algorithm and therefore no generating inferences
-      prepared=false;
-      return false;
-    }
-
-    IndexManager* imgr=salg->getIndexManager();
-    ASS(imgr);
-  start:
-    switch(stage) {
-    case 0:  //resolution
-    {
-      if(!imgr->contains(BINARY_RESOLUTION_SUBST_TREE)) { stage++; goto start; }
-      BinaryResolutionIndex* gli=static_cast<BinaryResolutionIndex*>(imgr->get(BINARY_RESOLUTION_SUBST_TREE));
-      ASS(gli);
-
-      nextIt=pvi( getStaticCastIterator<void>(gli->getUnifications(lit,true,false)) );
-      break;
-    }
-    case 1:  //backward superposition
-    {
-      if(!imgr->contains(SUPERPOSITION_SUBTERM_SUBST_TREE)) { stage++; goto start; }
-      TermIndex* bsi=static_cast<TermIndex*>(imgr->get(SUPERPOSITION_SUBTERM_SUBST_TREE));
-      ASS(bsi);
-
-      nextIt=pvi( getMapAndFlattenIterator(
-	       EqHelper::getLHSIterator(lit, _parent._ord),
-	       TermUnificationRetriever(bsi)) );
-      break;
-    }
-    case 2:  //forward superposition
-    {
-      if(!imgr->contains(SUPERPOSITION_LHS_SUBST_TREE)) { stage++; goto start; }
-      TermIndex* fsi=static_cast<TermIndex*>(imgr->get(SUPERPOSITION_LHS_SUBST_TREE));
-      ASS(fsi);
-
-      nextIt=pvi( getMapAndFlattenIterator(
-	       EqHelper::getSubtermIterator(lit, _parent._ord), //TODO update for combinatory sup
-	       TermUnificationRetriever(fsi)) );
-      break;
-    }
-    case 3:  //equality resolution
-    {
-      bool haveEqRes=false;
-      if(lit->isNegative() && lit->isEquality()) {
-	RobSubstitution rs;
-	if(rs.unify(*lit->nthArgument(0), 0, *lit->nthArgument(1), 0)) {
-	  haveEqRes=true;
-	  nextIt=pvi( getStaticCastIterator<void>(getSingletonIterator(0)) );
-	}
-      }
-      if(!haveEqRes) {
-	stage++;
-	goto start;
-      }
-      break;
-    }
-    default:
-      ASSERTION_VIOLATION;
-    case 4:  //finish
-    {
-      prepared=false;
-      return false;
-    }
+  //resolution
+  if(imgr->contains(BINARY_RESOLUTION_SUBST_TREE)) {
+    BinaryResolutionIndex* gli=static_cast<BinaryResolutionIndex*>(imgr->get(BINARY_RESOLUTION_SUBST_TREE));
+    res+=gli->estimateUnificationCount(lit, true, ESTIMATE_BUDGET);
+  }
+  //backward superposition
+  if(imgr->contains(SUPERPOSITION_SUBTERM_SUBST_TREE)) {
+    TermIndex* bsi=static_cast<TermIndex*>(imgr->get(SUPERPOSITION_SUBTERM_SUBST_TREE));
+    auto lhsIt=EqHelper::getLHSIterator(lit, _ord);
+    while(lhsIt.hasNext()) {
+      res+=bsi->estimateUnificationCount(lhsIt.next(), ESTIMATE_BUDGET);
     }
-    prepared=true;
-    return true;
   }
-
-  VirtualIterator<void> next()
-  {
-    if(!prepared) {
-      ALWAYS(hasNext());
+  //forward superposition
+  if(imgr->contains(SUPERPOSITION_LHS_SUBST_TREE)) {
+    TermIndex* fsi=static_cast<TermIndex*>(imgr->get(SUPERPOSITION_LHS_SUBST_TREE));
+    auto stIt=EqHelper::getSubtermIterator(lit, _ord); //TODO update for combinatory sup
+    while(stIt.hasNext()) {
+      res+=fsi->estimateUnificationCount(stIt.next(), ESTIMATE_BUDGET);
     }
-    ASS(prepared);
-    prepared=false;
-    stage++;
-    return nextIt;
   }
-private:
-
-  struct TermUnificationRetriever
-  {
-    TermUnificationRetriever(TermIndex* index) : _index(index) {}
-    VirtualIterator<void> operator()(TypedTermList trm)
-    {
-      return pvi( getStaticCastIterator<void>(_index->getUnifications(trm,false)) );
+  //equality resolution
+  if(lit->isNegative() && lit->isEquality()) {
+    RobSubstitution rs;
+    if(rs.unify(*lit->nthArgument(0), 0, *lit->nthArgument(1), 0)) {
+      res++;
     }
-  private:
-    TermIndex* _index;
-  };
-
-  int stage;
-  Literal* lit;
-  bool prepared;
-  VirtualIterator<void> nextIt;
-
-  LookaheadLiteralSelector& _parent;
-};
-
-/**
- * Return iterator with the same number of elements as there are inferences
- * that can be performed with @b lit literal selected
- */
-VirtualIterator<void> LookaheadLiteralSelector::getGeneraingInferenceIterator(Literal* lit)
-{
-  return pvi( getFlattenedIterator(GenIteratorIterator(lit, *this)) );
+  }
+  return res;
 }
 
 /**
@@ -182,25 +106,20 @@ Literal* LookaheadLiteralSelector::pickTheBest(Literal** lits, unsigned cnt)
 {
   ASS_G(cnt,1); //special cases are handled elsewhere
 
-  static DArray<VirtualIterator<void> > runifs; //resolution unification iterators
-  runifs.ensure(cnt);
-
-  for(unsigned i=0;i<cnt;i++) {
-    runifs[i]=getGeneraingInferenceIterator(lits[i]);
-  }
-
+  //the literals with the fewest inferences are the candidates
   static Stack<Literal*> candidates;
   candidates.reset();
-  do {
-    for(unsigned i=0;i<cnt;i++) {
-      if(runifs[i].hasNext()) {
-	runifs[i].next();
-      }
-      else {
-	candidates.push(lits[i]);
-      }
+  size_t best=0;
+  for(unsigned i=0;i<cnt;i++) {
+    size_t estimate=estimateInferenceCount(lits[i]);
+    if(candidates.isEmpty() || estimate<best) {
+      candidates.reset();
+      best=estimate;
     }
-  } while(candidates.isEmpty());
+    if(estimate==best) {
+      candidates.push(lits[i]);
+    }
+  }
 
   using namespace LiteralComparators;
   typedef Composite<ColoredFirst,
@@ -219,9 +138,6 @@ Literal* LookaheadLiteralSelector::pickTheBest(Literal** lits, unsigned cnt)
     }
   }
 
-  for(unsigned i=0;i<cnt;i++) {
-    runifs[i].drop(); //release the iterators
-  }
   return res;
 }
 
@@ -42,9 +42,10 @@ protected:
 private:
   Literal* pickTheBest(Literal** lits, unsigned cnt);
   void removeVariants(LiteralStack& lits);
-  VirtualIterator<void> getGeneraingInferenceIterator(Literal* lit);
+  size_t estimateInferenceCount(Literal* lit);
 
-  struct GenIteratorIterator;
+  /** maximal number of index nodes visited by a single query of estimateInferenceCount() */
+  static const unsigned ESTIMATE_BUDGET=64;
 
   bool _completeSelection;
   LiteralSelector* _startupSelector;
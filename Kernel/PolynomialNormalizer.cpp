@@ -322,7 +322,23 @@ NormalizationResult normalizeNumSort(TermList t, NormalizationResult* ts)
   DBG("out : ", out);                                                                                         \
   return out;                                                                                                 \
 
+PolyNf normalizeTermUncached(TypedTermList t);
+
 PolyNf normalizeTerm(TypedTermList t) 
+{
+  // shared terms are never deleted and determine their sort, hence their normal form 
+  // can be reused across clauses. The cache is bounded to not grow with the whole run.
+  if (t.isTerm() && t.term()->shared()) {
+    static Memo::Bounded<Term*, PolyNf> cache(Memo::BOUNDED_CAPACITY);
+    auto term = t.term();
+    return cache.get(term).unwrapOrElse([&]() {
+      return cache.getOrInit(term, [&]() { return normalizeTermUncached(t); });
+    });
+  }
+  return normalizeTermUncached(t);
+}
+
+PolyNf normalizeTermUncached(TypedTermList t) 
 {
   DEBUG("normalizing ", t)
   Memo::None<TypedTermList,NormalizationResult> memo;
@@ -374,7 +390,7 @@ TermList PolyNf::denormalize() const
         ); }
   };
 
-  static Memo::Hashed<PolyNf, TermList, StlHash> memo;
+  static Memo::Bounded<PolyNf, TermList, StlHash> memo(Memo::BOUNDED_CAPACITY);
   return evaluateBottomUp(*this, Eval{}, memo);
 }
 
@@ -30,8 +30,8 @@ namespace Kernel
 using namespace std;
 using namespace Lib;
 
-const int RobSubstitution::SPECIAL_INDEX=-2;
-const int RobSubstitution::UNBOUND_INDEX=-1;
+constexpr int RobSubstitution::SPECIAL_INDEX;
+constexpr int RobSubstitution::UNBOUND_INDEX;
 
 /**
  * Unify @b t1 and @b t2, and return true iff it was successful.
@@ -227,8 +227,8 @@ private:
   RobSubstitution& operator=(const RobSubstitution& obj) = delete;
 
 
-  static const int SPECIAL_INDEX;
-  static const int UNBOUND_INDEX;
+  static constexpr int SPECIAL_INDEX=-2;
+  static constexpr int UNBOUND_INDEX=-1;
 
   bool isUnbound(VarSpec v) const;
   TermSpec deref(VarSpec v) const;
@@ -255,7 +255,146 @@ private:
     return VarSpec(tl.var(), index);
   }
 
-  typedef DHMap<VarSpec,TermSpec,VarSpec::Hash1, VarSpec::Hash2> BankType;
+  /**
+   * Bindings of variables, kept in one dense array per variable bank,
+   * indexed by the variable number. Variables bound since the last reset
+   * are pushed on a trail, so that a reset only has to clear those,
+   * instead of the whole map.
+   *
+   * Variable numbers are not bounded (special variables of indices keep
+   * getting new ones), so only the numbers below MAX_DENSE_VAR get a slot
+   * in the arrays, the rest is kept in a hash map emptied on reset.
+   */
+  class BankType
+  {
+  public:
+    BankType() : _size(0) {}
+
+    BankType(BankType&&) = default;
+    BankType& operator=(BankType&&) = default;
+
+    bool find(const VarSpec& v) const
+    {
+      const TermSpec* b = slot(v);
+      return b && !b->term.isEmpty();
+    }
+    /** If @b v is bound, assign its binding into @b res and return true */
+    bool find(const VarSpec& v, TermSpec& res) const
+    {
+      const TermSpec* b = slot(v);
+      if(!b || b->term.isEmpty()) {
+        return false;
+      }
+      res = *b;
+      return true;
+    }
+    void set(const VarSpec& v, const TermSpec& b)
+    {
+      ASS(!b.term.isEmpty());
+      TermSpec& s = ensureSlot(v);
+      if(s.term.isEmpty()) {
+        _size++;
+        _trail.push(v);
+      }
+      s = b;
+    }
+    /**
+     * Give @b v back the binding @b previous it had before it was last
+     * bound (the empty term if it was unbound).
+     */
+    void undo(const VarSpec& v, const TermSpec& previous)
+    {
+      TermSpec* s = slot(v);
+      ASS(s && !s->term.isEmpty());
+      if(previous.term.isEmpty()) {
+        _size--;
+        // bindings are mostly undone in the reverse order, which keeps the trail short
+        if(_trail.isNonEmpty() && _trail.top()==v) {
+          _trail.pop();
+        }
+      }
+      *s = previous;
+    }
+    void reset()
+    {
+      while(_trail.isNonEmpty()) {
+        TermSpec* s = slot(_trail.pop());
+        if(s) {
+          s->term.makeEmpty();
+        }
+      }
+      _sparse.reset();
+      _size = 0;
+    }
+    size_t size() const { return _size; }
+
+    friend std::ostream& operator<<(std::ostream& out, BankType const& self)
+    {
+      out << "{";
+      for(unsigned i = 0; i < self._trail.size(); i++) {
+        TermSpec b;
+        if(self.find(self._trail[i], b)) {
+          out << " " << self._trail[i] << " -> " << b;
+        }
+      }
+      return out << " }";
+    }
+
+  private:
+    static const unsigned MAX_DENSE_VAR = 1024;
+    static const unsigned MAX_DENSE_BANK = 64;
+
+    static bool isDense(const VarSpec& v)
+    {
+      ASS_GE(v.index, SPECIAL_INDEX);
+      return v.var < MAX_DENSE_VAR && unsigned(v.index - SPECIAL_INDEX) < MAX_DENSE_BANK;
+    }
+
+    TermSpec* slot(const VarSpec& v)
+    {
+      if(!isDense(v)) {
+        return _sparse.findPtr(v);
+      }
+      unsigned bank = v.index - SPECIAL_INDEX;
+      if(bank >= _banks.size() || v.var >= _banks[bank].size()) {
+        return nullptr;
+      }
+      return &_banks[bank][v.var];
+    }
+    const TermSpec* slot(const VarSpec& v) const
+    { return const_cast<BankType*>(this)->slot(v); }
+
+    TermSpec& ensureSlot(const VarSpec& v)
+    {
+      if(!isDense(v)) {
+        TermSpec* s;
+        if(_sparse.getValuePtr(v, s)) {
+          s->term.makeEmpty();
+        }
+        return *s;
+      }
+      unsigned bank = v.index - SPECIAL_INDEX;
+      while(_banks.size() <= bank) {
+        _banks.push(Stack<TermSpec>());
+      }
+      Stack<TermSpec>& vars = _banks[bank];
+      while(vars.size() <= v.var) {
+        TermSpec empty;
+        empty.term.makeEmpty();
+        vars.push(empty);
+      }
+      return vars[v.var];
+    }
+
+    /** bindings of variables of the bank @b index are at position index-SPECIAL_INDEX */
+    Stack<Stack<TermSpec>> _banks;
+    /** bindings of the variables which do not fit into @b _banks */
+    DHMap<VarSpec,TermSpec,VarSpec::Hash1,VarSpec::Hash2> _sparse;
+    /** variables bound since the last reset, possibly with some that were unbound again */
+    Stack<VarSpec> _trail;
+    /** number of bound variables */
+    size_t _size;
+  };
 
   FuncSubtermMap* _funcSubtermMap;
   BankType _bank;
@@ -277,11 +416,7 @@ private:
     }
     void backtrack()
     {
-      if(_term.term.isEmpty()) {
-	_subst->_bank.remove(_var);
-      } else {
-	_subst->_bank.set(_var,_term);
-      }
+      _subst->_bank.undo(_var,_term);
     }
     friend std::ostream& operator<<(std::ostream& out, BindingBacktrackObject const& self)
     { return out << "(ROB backtrack object for " << self._var << ")"; }
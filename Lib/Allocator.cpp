@@ -16,11 +16,83 @@
  * @since 24/07/2023, mostly replaced by a small-object allocator
  */
 
+#include <algorithm>
+#include <vector>
+
 #include "Allocator.hpp"
 #include "Lib/Timer.hpp"
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 #ifndef INDIVIDUAL_ALLOCATIONS
 Lib::SmallObjectAllocator Lib::GLOBAL_SMALL_OBJECT_ALLOCATOR;
+
+size_t Lib::reclaimFreeBlocks(void *&blocks, void **&free_list, char *currentBlock, size_t size, size_t count) {
+  // the blocks sorted by address, together with the number of free chunks in each
+  std::vector<std::pair<char *, size_t>> sorted;
+  for(void *block = blocks; block; block = *static_cast<void **>(block))
+    if(block != currentBlock)
+      sorted.emplace_back(static_cast<char *>(block), 0);
+  if(sorted.empty())
+    return 0;
+  std::sort(sorted.begin(), sorted.end());
+
+  // the block containing `chunk`, or `sorted.end()` if it's in the current block
+  auto blockOf = [&](void *chunk) {
+    char *c = static_cast<char *>(chunk);
+    auto it = std::upper_bound(sorted.begin(), sorted.end(), std::make_pair(c, SIZE_MAX));
+    if(it == sorted.begin())
+      return sorted.end();
+    --it;
+    return c < it->first + count * size ? it : sorted.end();
+  };
+
+  for(void **chunk = free_list; chunk; chunk = static_cast<void **>(*chunk)) {
+    auto it = blockOf(chunk);
+    if(it != sorted.end())
+      it->second++;
+  }
+
+  // a block is completely free if all but the reserved chunk are in the free list
+  auto completelyFree = [count](std::pair<char *, size_t> const& entry) {
+    ASS_LE(entry.second, count - 1)
+    return entry.second == count - 1;
+  };
+  if(std::none_of(sorted.begin(), sorted.end(), completelyFree))
+    return 0;
+
+  // rebuild the free list, dropping chunks in blocks about to be released
+  void **chunk = free_list;
+  free_list = nullptr;
+  while(chunk) {
+    void **next = static_cast<void **>(*chunk);
+    auto it = blockOf(chunk);
+    if(it == sorted.end() || !completelyFree(*it)) {
+      *chunk = free_list;
+      free_list = chunk;
+    }
+    chunk = next;
+  }
+
+  // relink the surviving blocks and release the rest
+  size_t released = 0;
+  blocks = currentBlock;
+  if(currentBlock)
+    *reinterpret_cast<void **>(currentBlock) = nullptr;
+  for(auto &entry : sorted) {
+    if(completelyFree(entry)) {
+      ::operator delete(entry.first, count * size);
+      released += count * size;
+    }
+    else {
+      *reinterpret_cast<void **>(entry.first) = blocks;
+      blocks = entry.first;
+    }
+  }
+  return released;
+}
 #endif
 
 static size_t ALLOCATED = 0;
@@ -83,3 +155,17 @@ void Lib::deprecatedFree(void *ptr) {
   TimeoutProtector tp;
   std::free(ptr);
 }
+
+size_t Lib::releaseFreeMemory() {
+#ifndef INDIVIDUAL_ALLOCATIONS
+  size_t released = GLOBAL_SMALL_OBJECT_ALLOCATOR.reclaim();
+#else
+  size_t released = 0;
+#endif
+  TimeoutProtector tp;
+#if defined(__GLIBC__)
+  // give free pages at the top of the heap and in its holes back to the OS (via madvise)
+  malloc_trim(0);
+#endif
+  return released;
+}
@@ -21,6 +21,7 @@
 #define __Allocator__
 
 #include <cstddef>
+#include <cstdint>
 #include <new>
 
 #include "Debug/Assertion.hpp"
@@ -48,6 +49,16 @@ void *deprecatedAlloc(size_t size);
 void *deprecatedRealloc(void *ptr, size_t new_size);
 void deprecatedFree(void *ptr);
 
+/*
+ * Hand memory that is no longer in use back to the system:
+ * completely-free blocks of the small-object allocator are released
+ * and (where supported) the C library is asked to return unused pages to the OS.
+ *
+ * Intended to be called at phase boundaries, e.g. after preprocessing.
+ * Returns the number of bytes released by the small-object allocator.
+ */
+size_t releaseFreeMemory();
+
 }
 
 #ifdef INDIVIDUAL_ALLOCATIONS
@@ -68,14 +79,24 @@ inline void free(void *pointer, size_t size, size_t align = alignof(std::max_ali
 
 namespace Lib {
 
+/*
+ * The implementation of `FixedSizeAllocator::reclaim()`, independent of the chunk size:
+ * `blocks` links the blocks of `count` chunks of `size` bytes, `free_list` the free chunks.
+ */
+size_t reclaimFreeBlocks(void *&blocks, void **&free_list, char *currentBlock, size_t size, size_t count);
+
 /*
  * A simple fixed-size allocator.
  * Allocates largish blocks of memory (`COUNT * SIZE` bytes) from the system,
  * chopping it into smaller fixed-size chunks for fast allocation/deallocation.
  * Chunks are `SIZE` bytes long, aligned to the greatest common divisor of `SIZE` and `alignof(std::max_align_t)`.
  *
- * The allocator never releases memory to the system, instead retaining it in a free list for reallocation.
+ * The allocator does not release memory to the system by itself, instead retaining it in a free list for reallocation.
  * This fits Vampire's generally-growing allocation pattern reasonably well in practice.
+ * After a phase that churns through many short-lived objects (e.g. preprocessing),
+ * `reclaim()` can be called to give blocks that are entirely free back to the system.
+ *
+ * The first chunk of each block is reserved to link all blocks together for `reclaim()`.
  */
 template<size_t SIZE>
 class FixedSizeAllocator {
@@ -89,7 +110,7 @@ class FixedSizeAllocator {
   struct Block {
     /**
      * The block allocated from the system, that we chop up into little bits.
-     * Leaked by design to clean up quickly at program exit.
+     * Leaked by design to clean up quickly at program exit, unless released early by `reclaim()`.
      * NB: if deleted, must happen _after_ all its allocations are freed - tricky for the global allocator!
      *
      * TODO if we want to use Valgrind or similar tools, this will be reported as leaked.
@@ -109,8 +130,10 @@ class FixedSizeAllocator {
     }
   };
 
-  // the current block - old blocks are leaked
+  // the current block
   Block current;
+  // all blocks obtained from the system, linked through their first chunk
+  void *blocks = nullptr;
   /*
    * The free list.
    *
@@ -135,8 +158,11 @@ public:
       return current.alloc();
 
     // current block full, get a new one
-    current.bytes = static_cast<char *>(::operator new(COUNT * SIZE));
-    current.remaining = COUNT * SIZE;
+    char *block = static_cast<char *>(::operator new(COUNT * SIZE));
+    *reinterpret_cast<void **>(block) = blocks;
+    blocks = block;
+    current.bytes = block + SIZE;
+    current.remaining = (COUNT - 1) * SIZE;
     return current.alloc();
   }
 
@@ -147,6 +173,18 @@ public:
     *head = free_list;
     free_list = head;
   }
+
+  /*
+   * Release all blocks whose chunks are all in the free list back to the system.
+   * The current block is never released.
+   *
+   * Linear in the size of the free list (plus sorting of the blocks), so call it sparingly.
+   * Returns the number of bytes released.
+   */
+  size_t reclaim() {
+    char *currentBlock = current.bytes ? current.bytes - SIZE : nullptr;
+    return reclaimFreeBlocks(blocks, free_list, currentBlock, SIZE, COUNT);
+  }
 };
 
 /*
@@ -226,6 +264,16 @@ public:
     ::operator delete(pointer, size);
   }
 
+  // release completely-free blocks of all size classes, returning the number of bytes released
+  size_t reclaim() {
+    return FSA1.reclaim()
+      + FSA2.reclaim()
+      + FSA3.reclaim()
+      + FSA4.reclaim()
+      + FSA6.reclaim()
+      + FSA8.reclaim();
+  }
+
 private:
   // sizes tuned somewhat based on real allocation data, but I don't claim they couldn't be better!
   // when tuning, bear in mind that the larger the gap between sizes, the more memory is wasted
@@ -78,15 +78,18 @@ public:
   inline
   void reserve(size_t capacity) 
   {
-    if (_capacity >= capacity) {
+    if (size_t(_end - _stack) >= capacity) {
       return;
     }
     C* mem = static_cast<C*>(ALLOC_KNOWN(capacity*sizeof(C),className()));
     if (_stack) {
       for (unsigned i = 0; i < size(); i++) {
         ::new(&mem[i]) C(std::move((*this)[i]));
+        (*this)[i].~C();
+      }
+      if (_capacity) {
+        DEALLOC_KNOWN(_stack,_capacity*sizeof(C),className());
       }
-      DEALLOC_KNOWN(_stack,_capacity*sizeof(C),className());
 
       _cursor = mem + (_cursor - _stack);
       _capacity = capacity;
@@ -102,7 +105,7 @@ public:
 
 
   Stack(const Stack& s)
-   : _capacity(s._capacity)
+   : _capacity(s._end - s._stack)
   {
     if(_capacity) {
       void* mem = ALLOC_KNOWN(_capacity*sizeof(C),className());
@@ -117,12 +120,17 @@ public:
     loadFromIterator(BottomFirstIterator(const_cast<Stack&>(s)));
   }
 
-  Stack(Stack&& s) noexcept
+  /**
+   * Take over the content of @b s. This only allocates (and so may throw) if
+   * @b s keeps its elements in the buffer of an InlineStack, which cannot be
+   * passed on, so that the elements have to be moved one by one.
+   */
+  Stack(Stack&& s)
   {
     _capacity = 0;
     _stack = _cursor = _end = nullptr;
 
-    std::swap(*this,s);
+    moveFrom(s);
   }
 
   /** De-allocate the stack
@@ -137,12 +145,9 @@ public:
     while(p!=_stack) {
       (--p)->~C();
     }
-    if(_stack) {
+    if(_capacity) {
       DEALLOC_KNOWN(_stack,_capacity*sizeof(C),className());
     }
-    else {
-      ASS_EQ(_capacity,0);
-    }
   }
 
   Stack& operator=(const Stack& s)
@@ -155,9 +160,13 @@ public:
     return *this;
   }
 
-  Stack& operator=(Stack&& s) noexcept
+  /** See the move constructor for when this may allocate. */
+  Stack& operator=(Stack&& s)
   {
-    std::swap(*this,s);
+    if(&s != this) {
+      reset();
+      moveFrom(s);
+    }
     return *this;
   }
 
@@ -754,6 +763,60 @@ protected:
   /** points to after the last possible value for _cursor */
   C* _end;
 
+  /*
+   * A stack either owns _stack, which then has _capacity elements, or
+   * borrows it from an InlineStack, with _capacity 0 and _end marking the end
+   * of the buffer. In the latter case _stack is not deallocated, and it is
+   * never handed over to another stack.
+   */
+
+  /**
+   * Create an empty stack keeping its elements in @b buffer of @b capacity
+   * elements, until it has to grow. The buffer must outlive the stack.
+   */
+  Stack(C* buffer, size_t capacity)
+    : _capacity(0), _stack(buffer), _cursor(buffer), _end(buffer+capacity)
+  {
+    ASS_G(capacity,0);
+  }
+
+  bool borrowed() const { return _stack && !_capacity; }
+
+  /** Move the content of the stack from a borrowed buffer to an allocated one */
+  void ownBuffer()
+  {
+    if(borrowed()) {
+      reserve(_end-_stack+1);
+      ASS(!borrowed());
+    }
+  }
+
+  /**
+   * Take over the elements of @b s, leaving it empty. This stack must be
+   * empty, and its buffer is kept if @b s has to have its elements moved.
+   */
+  void moveFrom(Stack& s)
+  {
+    ASS(isEmpty());
+    if(s.borrowed()) {
+      reserve(s.size());
+      for (C& el : s) {
+        push(std::move(el));
+      }
+      s.reset();
+      return;
+    }
+    if(_capacity) {
+      DEALLOC_KNOWN(_stack,_capacity*sizeof(C),className());
+    }
+    _capacity = s._capacity;
+    _stack = s._stack;
+    _cursor = s._cursor;
+    _end = s._end;
+    s._capacity = 0;
+    s._stack = s._cursor = s._end = nullptr;
+  }
+
   /**
    * Expand the stack. Note: the function heavily uses
    * the fact that the expansion happens exactly when _cursor=_end
@@ -763,23 +826,26 @@ protected:
   {
     ASS(_cursor == _end);
 
-    size_t newCapacity = _capacity ? (2 * _capacity) : 8;
+    size_t oldCapacity = _end - _stack;
+    size_t newCapacity = oldCapacity ? (2 * oldCapacity) : 8;
 
     // allocate new stack and copy old stack's content to the new place
     void* mem = ALLOC_KNOWN(newCapacity*sizeof(C),className());
 
     C* newStack = static_cast<C*>(mem);
-    if(_capacity) {
-      for (size_t i = 0; i<_capacity; i++) {
+    if(oldCapacity) {
+      for (size_t i = 0; i<oldCapacity; i++) {
         ::new(newStack+i) C(std::move(_stack[i]));
         _stack[i].~C();
       }
-      // deallocate the old stack
-      DEALLOC_KNOWN(_stack,_capacity*sizeof(C),className());
+      // deallocate the old stack, unless it is borrowed
+      if(_capacity) {
+        DEALLOC_KNOWN(_stack,_capacity*sizeof(C),className());
+      }
     }
 
     _stack = newStack;
-    _cursor = _stack + _capacity;
+    _cursor = _stack + oldCapacity;
     _end = _stack + newCapacity;
     _capacity = newCapacity;
   } // Stack::expand
@@ -825,6 +891,39 @@ public:
 
 };
 
+/**
+ * A stack keeping up to @b N elements in place, and allocating only when it
+ * grows beyond that. Meant for scratch stacks local to a function, which
+ * would otherwise allocate on every call (or be made static to avoid that,
+ * and so not reentrant).
+ *
+ * It can be passed wherever a Stack<C>& is expected. If its content is moved
+ * into another stack, the elements are moved one by one; if it is swapped,
+ * they are first moved to the heap.
+ */
+template<class C, unsigned N>
+class InlineStack
+: public Stack<C>
+{
+public:
+  CLASS_NAME(InlineStack);
+  USE_ALLOCATOR(InlineStack);
+
+  InlineStack() : Stack<C>(reinterpret_cast<C*>(_buffer), N) {}
+
+  ~InlineStack()
+  {
+    // destroy the elements while the buffer is alive
+    this->reset();
+  }
+
+  InlineStack(const InlineStack&) = delete;
+  InlineStack& operator=(const InlineStack&) = delete;
+
+private:
+  alignas(C) char _buffer[N*sizeof(C)];
+};
+
 } // namespace Lib
 
 namespace std
@@ -834,6 +933,9 @@ template<typename T>
 void swap(Lib::Stack<T>& s1, Lib::Stack<T>& s2)
 {
   using std::swap;//ADL
+  // a buffer can only be passed to the other stack if it is not embedded in this one
+  s1.ownBuffer();
+  s2.ownBuffer();
   swap(s1._capacity, s2._capacity);
   swap(s1._cursor, s2._cursor);
   swap(s1._end, s2._end);
@@ -0,0 +1,663 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SwissMap.hpp
+ * Defines classes SwissMap<Key,Val,Hash> and SwissSet<Val,Hash> of maps and sets,
+ * implemented as open-addressing hashtables probed by groups of metadata bytes.
+ */
+
+#ifndef __SwissMap__
+#define __SwissMap__
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "Forwards.hpp"
+
+#include "Debug/Assertion.hpp"
+#include "Allocator.hpp"
+#include "Exception.hpp"
+#include "Hash.hpp"
+
+namespace Lib {
+
+/**
+ * Class SwissMap implements generic maps with keys of a class Key and values
+ * of a class Val, with (a subset of) the interface of DHMap.
+ *
+ * The table is split into groups of 16 slots. Every slot has a metadata byte,
+ * which is either EMPTY, DELETED, or holds the lowest 7 bits of the hash of
+ * the key stored in the slot. A lookup compares all 16 metadata bytes of a
+ * group with these bits at once (using SSE2 or NEON where available) and only
+ * compares keys of the slots that matched, moving to the next group in the probe
+ * sequence only if the group had no empty slot.
+ *
+ * As in DHMap, reset() takes constant time: every group carries the timestamp
+ * of the last reset it was used after, and groups with an older timestamp are
+ * considered empty.
+ *
+ * @param Key anything that can be hashed by Hash and compared using ==
+ * @param Val values, must be default-constructible
+ * @param Hash class with a function hash() mapping keys to unsigned integers
+ */
+template <typename Key, typename Val, class Hash>
+class SwissMap
+{
+public:
+  CLASS_NAME(SwissMap);
+  USE_ALLOCATOR(SwissMap);
+
+  SwissMap()
+  : _timestamp(1), _size(0), _deleted(0), _groupCount(0), _groups(nullptr), _entries(nullptr)
+  { }
+
+  SwissMap(const SwissMap& obj) : SwissMap()
+  {
+    Iterator it(obj);
+    while(it.hasNext()) {
+      Key k;
+      Val v;
+      it.next(k, v);
+      ALWAYS(insert(k, v));
+    }
+  }
+
+  friend void swap(SwissMap& l, SwissMap& r)
+  {
+    std::swap(l._timestamp, r._timestamp);
+    std::swap(l._size, r._size);
+    std::swap(l._deleted, r._deleted);
+    std::swap(l._groupCount, r._groupCount);
+    std::swap(l._groups, r._groups);
+    std::swap(l._entries, r._entries);
+  }
+
+  SwissMap(SwissMap&& obj) : SwissMap()
+  { swap(*this, obj); }
+
+  SwissMap& operator=(SwissMap&& obj)
+  { swap(*this, obj); return *this; }
+
+  ~SwissMap()
+  {
+    if(_groupCount) {
+      deallocate(_groups, _entries, _groupCount);
+    }
+  }
+
+  /** Empty the SwissMap */
+  void reset()
+  {
+    _timestamp++;
+    _size = 0;
+    _deleted = 0;
+    if(_timestamp == 0) {
+      // overflow, make sure no group looks current
+      _timestamp = 1;
+      for(unsigned i = 0; i < _groupCount; i++) {
+        _groups[i].timestamp = 0;
+      }
+    }
+  }
+
+  /**
+   * Find value by the @b key. The result is true if a pair with this key is
+   * in the map, and then its value is assigned to @b val. Otherwise @b val is
+   * left unchanged.
+   */
+  bool find(Key key, Val& val) const
+  {
+    const Entry* e = findEntry(key);
+    if(!e) {
+      return false;
+    }
+    val = e->_val;
+    return true;
+  }
+
+  /** Return true iff a pair with @b key as a key is in the map */
+  bool find(Key key) const
+  { return findEntry(key); }
+
+  /** Return a pointer to the value stored under @b key, or nullptr if there is none */
+  Val* findPtr(Key key)
+  {
+    Entry* e = const_cast<Entry*>(findEntry(key));
+    return e ? &e->_val : nullptr;
+  }
+
+  /**
+   * Return value associated with given key. A pair with
+   * this key has to be present.
+   */
+  const Val& get(Key key) const
+  {
+    const Entry* e = findEntry(key);
+    ASS(e);
+    return e->_val;
+  }
+
+  /**
+   * Return value associated with given key. A pair with
+   * this key has to be present.
+   */
+  Val& get(Key key)
+  {
+    Entry* e = const_cast<Entry*>(findEntry(key));
+    ASS(e);
+    return e->_val;
+  }
+
+  /** Return the value associated with @b key, or @b def if there is none */
+  Val get(Key key, Val def) const
+  {
+    const Entry* e = findEntry(key);
+    return e ? e->_val : def;
+  }
+
+  /**
+   * If there is no value stored under @b key in the map,
+   * insert pair (key,value) and return true. Otherwise,
+   * return false.
+   */
+  bool insert(Key key, const Val& val)
+  {
+    bool inserted;
+    Entry* e = findEntryToInsert(key, inserted);
+    if(inserted) {
+      e->_val = val;
+    }
+    return inserted;
+  }
+
+  /**
+   * Assign pair (key,value) to the map, and return true if the key was not
+   * present before.
+   */
+  bool set(Key key, const Val& val)
+  {
+    bool inserted;
+    Entry* e = findEntryToInsert(key, inserted);
+    e->_val = val;
+    return inserted;
+  }
+
+  /**
+   * If there is a value stored under the @b key, return it. Otherwise,
+   * insert @b val under the @b key and return @b val.
+   */
+  Val findOrInsert(Key key, const Val& val)
+  {
+    bool inserted;
+    Entry* e = findEntryToInsert(key, inserted);
+    if(inserted) {
+      e->_val = val;
+    }
+    return e->_val;
+  }
+
+  /**
+   * Assign into @b pval a pointer to the value stored under @b key. If there
+   * was none, insert @b initial under the @b key first and return true.
+   * Otherwise return false.
+   */
+  bool getValuePtr(Key key, Val*& pval, const Val& initial)
+  {
+    bool inserted;
+    Entry* e = findEntryToInsert(key, inserted);
+    if(inserted) {
+      e->_val = initial;
+    }
+    pval = &e->_val;
+    return inserted;
+  }
+
+  /**
+   * Assign into @b pval a pointer to the value stored under @b key. If there
+   * was none, insert a default-constructed value first and return true.
+   * Otherwise return false.
+   */
+  bool getValuePtr(Key key, Val*& pval)
+  {
+    bool inserted;
+    Entry* e = findEntryToInsert(key, inserted);
+    if(inserted) {
+      e->_val = Val();
+    }
+    pval = &e->_val;
+    return inserted;
+  }
+
+  /**
+   * If there is a value stored under @b key, remove it, assign it into
+   * @b val and return true. Otherwise return false.
+   */
+  bool pop(Key key, Val& val)
+  {
+    Entry* e = const_cast<Entry*>(findEntry(key));
+    if(!e) {
+      return false;
+    }
+    val = std::move(e->_val);
+    erase(e);
+    return true;
+  }
+
+  /**
+   * If there is a value stored under @b key, remove it and return true.
+   * Otherwise return false.
+   */
+  bool remove(Key key)
+  {
+    Entry* e = const_cast<Entry*>(findEntry(key));
+    if(!e) {
+      return false;
+    }
+    erase(e);
+    return true;
+  }
+
+  /** Return the number of pairs stored in the map */
+  unsigned size() const
+  { return _size; }
+
+  /** Return true iff there are no pairs stored in the map */
+  bool isEmpty() const
+  { return _size == 0; }
+
+private:
+  static const unsigned GROUP_SIZE = 16;
+
+  static const uint8_t EMPTY = 0x80;
+  static const uint8_t DELETED = 0xFE;
+
+  struct Group {
+    uint8_t control[GROUP_SIZE];
+    /** the group is empty if this differs from the timestamp of the map */
+    unsigned timestamp;
+
+    /** Return a bitmask of the slots whose metadata byte is @b byte */
+    unsigned match(uint8_t byte) const
+    {
+#if defined(__SSE2__)
+      __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(byte))));
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+      static const uint8_t bits[GROUP_SIZE] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+      uint8x16_t eq = vceqq_u8(vld1q_u8(control), vdupq_n_u8(byte));
+      uint8x16_t weighted = vandq_u8(eq, vld1q_u8(bits));
+      return vaddv_u8(vget_low_u8(weighted)) | (vaddv_u8(vget_high_u8(weighted)) << 8);
+#else
+      unsigned res = 0;
+      for(unsigned i = 0; i < GROUP_SIZE; i++) {
+        res |= unsigned(control[i] == byte) << i;
+      }
+      return res;
+#endif
+    }
+  };
+
+  struct Entry {
+    Key _key;
+    Val _val;
+  };
+
+  /** the metadata byte of occupied slots is given by the lowest 7 bits of the hash */
+  static uint8_t hashByte(unsigned hash)
+  { return hash & 0x7F; }
+
+  /** the group where the probing starts is given by the remaining bits */
+  unsigned firstGroup(unsigned hash) const
+  { return (hash >> 7) & (_groupCount - 1); }
+
+  static unsigned lowestSlot(unsigned mask)
+  { return __builtin_ctz(mask); }
+
+  bool isCurrent(const Group& g) const
+  { return g.timestamp == _timestamp; }
+
+  const Entry* findEntry(Key key) const
+  {
+    if(_size == 0) {
+      return nullptr;
+    }
+    unsigned hash = Hash::hash(key);
+    uint8_t byte = hashByte(hash);
+    unsigned gi = firstGroup(hash);
+    // triangular probing visits every group, as their number is a power of two
+    for(unsigned step = 1; ; step++) {
+      const Group& g = _groups[gi];
+      if(!isCurrent(g)) {
+        return nullptr;
+      }
+      for(unsigned m = g.match(byte); m; m &= m - 1) {
+        const Entry* e = &_entries[gi * GROUP_SIZE + lowestSlot(m)];
+        if(e->_key == key) {
+          return e;
+        }
+      }
+      if(g.match(EMPTY)) {
+        return nullptr;
+      }
+      ASS_L(step, _groupCount);
+      gi = (gi + step) & (_groupCount - 1);
+    }
+  }
+
+  /**
+   * Return the entry containing @b key. If there is none, claim a slot for it,
+   * store the key there and set @b inserted to true (the value is to be set by
+   * the caller).
+   */
+  Entry* findEntryToInsert(Key key, bool& inserted)
+  {
+    ensureExpanded();
+    unsigned hash = Hash::hash(key);
+    uint8_t byte = hashByte(hash);
+    unsigned gi = firstGroup(hash);
+    Group* target = nullptr;
+    unsigned targetSlot = 0;
+    for(unsigned step = 1; ; step++) {
+      Group& g = _groups[gi];
+      if(!isCurrent(g)) {
+        memset(g.control, EMPTY, GROUP_SIZE);
+        g.timestamp = _timestamp;
+      }
+      for(unsigned m = g.match(byte); m; m &= m - 1) {
+        Entry* e = &_entries[gi * GROUP_SIZE + lowestSlot(m)];
+        if(e->_key == key) {
+          inserted = false;
+          return e;
+        }
+      }
+      if(!target) {
+        if(unsigned m = g.match(DELETED)) {
+          target = &g;
+          targetSlot = lowestSlot(m);
+        }
+      }
+      if(unsigned m = g.match(EMPTY)) {
+        if(target) {
+          _deleted--;
+        } else {
+          target = &g;
+          targetSlot = lowestSlot(m);
+        }
+        break;
+      }
+      ASS_L(step, _groupCount);
+      gi = (gi + step) & (_groupCount - 1);
+    }
+    target->control[targetSlot] = byte;
+    _size++;
+    Entry* e = &_entries[(target - _groups) * GROUP_SIZE + targetSlot];
+    e->_key = key;
+    inserted = true;
+    return e;
+  }
+
+  void erase(Entry* e)
+  {
+    unsigned pos = e - _entries;
+    Group& g = _groups[pos / GROUP_SIZE];
+    // a slot in a group without empty slots has to stay a tombstone, so that
+    // probe sequences passing through the group are not cut short
+    if(g.match(EMPTY)) {
+      g.control[pos % GROUP_SIZE] = EMPTY;
+    } else {
+      g.control[pos % GROUP_SIZE] = DELETED;
+      _deleted++;
+    }
+    e->_val = Val();
+    _size--;
+  }
+
+  /** Check whether there is still a free slot beyond the maximal load of 7/8, if not, rehash */
+  void ensureExpanded()
+  {
+    if((_size + _deleted + 1) * 8 > _groupCount * GROUP_SIZE * 7) {
+      // grow unless it is mostly the tombstones that fill the table
+      unsigned groupCount = _groupCount == 0 ? 1
+          : (_size + 1) * 2 * 8 > _groupCount * GROUP_SIZE * 7 ? _groupCount * 2 : _groupCount;
+      rehash(groupCount);
+    }
+  }
+
+  void rehash(unsigned groupCount)
+  {
+    if(groupCount > (1u << 26)) {
+      throw Exception("Lib::SwissMap::rehash: maximal capacity reached.");
+    }
+    Group* oldGroups = _groups;
+    Entry* oldEntries = _entries;
+    unsigned oldGroupCount = _groupCount;
+    unsigned oldTimestamp = _timestamp;
+
+    _groups = static_cast<Group*>(ALLOC_KNOWN(groupCount * sizeof(Group), "SwissMap::Group"));
+    for(unsigned i = 0; i < groupCount; i++) {
+      _groups[i].timestamp = 0;
+    }
+    _entries = array_new<Entry>(ALLOC_KNOWN(groupCount * GROUP_SIZE * sizeof(Entry), "SwissMap::Entry"), groupCount * GROUP_SIZE);
+    _groupCount = groupCount;
+    _timestamp = 1;
+    _size = 0;
+    _deleted = 0;
+
+    for(unsigned gi = 0; gi < oldGroupCount; gi++) {
+      const Group& g = oldGroups[gi];
+      if(g.timestamp != oldTimestamp) {
+        continue;
+      }
+      for(unsigned i = 0; i < GROUP_SIZE; i++) {
+        if(!(g.control[i] & 0x80)) {
+          Entry& old = oldEntries[gi * GROUP_SIZE + i];
+          bool inserted;
+          findEntryToInsert(old._key, inserted)->_val = std::move(old._val);
+          ASS(inserted);
+        }
+      }
+    }
+    if(oldGroupCount) {
+      deallocate(oldGroups, oldEntries, oldGroupCount);
+    }
+  }
+
+  static void deallocate(Group* groups, Entry* entries, unsigned groupCount)
+  {
+    array_delete(entries, groupCount * GROUP_SIZE);
+    DEALLOC_KNOWN(entries, groupCount * GROUP_SIZE * sizeof(Entry), "SwissMap::Entry");
+    DEALLOC_KNOWN(groups, groupCount * sizeof(Group), "SwissMap::Group");
+  }
+
+  /** operator= is private and without a body, because we don't want any. */
+  SwissMap& operator=(const SwissMap& obj);
+
+  /** groups with a different timestamp are considered empty */
+  unsigned _timestamp;
+  /** number of pairs stored in the map */
+  unsigned _size;
+  /** number of slots marked as DELETED */
+  unsigned _deleted;
+  /** number of groups, a power of two (or zero before the first insertion) */
+  unsigned _groupCount;
+  Group* _groups;
+  /** _groupCount*GROUP_SIZE entries, the slots of group i start at i*GROUP_SIZE */
+  Entry* _entries;
+
+public:
+  /**
+   * Class to allow iteration over keys and values stored in the map.
+   */
+  class Iterator {
+  public:
+    Iterator(const SwissMap& map) : _map(map), _next(0) {}
+
+    /** True if there exists next element */
+    bool hasNext()
+    {
+      unsigned last = _map._groupCount * GROUP_SIZE;
+      while(_next < last) {
+        const Group& g = _map._groups[_next / GROUP_SIZE];
+        if(!_map.isCurrent(g)) {
+          _next = (_next / GROUP_SIZE + 1) * GROUP_SIZE;
+          continue;
+        }
+        if(!(g.control[_next % GROUP_SIZE] & 0x80)) {
+          return true;
+        }
+        _next++;
+      }
+      return false;
+    }
+
+    /**
+     * Assign key and value of the next entry to respective parameters
+     * @warning hasNext() must have been called before
+     */
+    void next(Key& key, Val& val)
+    {
+      Entry* e = nextEntry();
+      key = e->_key;
+      val = e->_val;
+    }
+
+    /**
+     * Return next value via reference and pass corresponding key via argument.
+     * @warning hasNext() must have been called before
+     */
+    Val& nextRef(Key& key)
+    {
+      Entry* e = nextEntry();
+      key = e->_key;
+      return e->_val;
+    }
+
+    /**
+     * Return the next value
+     * @warning hasNext() must have been called before
+     */
+    Val next() { return nextEntry()->_val; }
+
+    /**
+     * Return the key of next entry
+     * @warning hasNext() must have been called before
+     */
+    Key nextKey() { return nextEntry()->_key; }
+
+  private:
+    Entry* nextEntry()
+    {
+      ASS_L(_next, _map._groupCount * GROUP_SIZE);
+      return &_map._entries[_next++];
+    }
+
+    const SwissMap& _map;
+    /** position of the slot at which the iterator looks for the next entry */
+    unsigned _next;
+  }; // class SwissMap::Iterator
+
+  friend std::ostream& operator<<(std::ostream& out, SwissMap const& self)
+  {
+    Iterator it(self);
+    out << "{ ";
+    bool first = true;
+    while(it.hasNext()) {
+      Key k;
+      Val& v = it.nextRef(k);
+      if(!first) {
+        out << ", ";
+      }
+      out << k << " -> " << v;
+      first = false;
+    }
+    return out << " }";
+  }
+}; // class SwissMap
+
+/**
+ * Class SwissSet implements generic sets with values of a class Val, as
+ * a SwissMap with empty values.
+ */
+template <typename Val, class Hash>
+class SwissSet
+{
+public:
+  CLASS_NAME(SwissSet);
+  USE_ALLOCATOR(SwissSet);
+
+  /** Empty the SwissSet */
+  void reset()
+  { _map.reset(); }
+
+  /** Return true iff @b val is in the set */
+  bool find(Val val) const
+  { return _map.find(val); }
+
+  /** Return true iff @b val is in the set (synonym for the @b find function) */
+  bool contains(Val val) const
+  { return find(val); }
+
+  /**
+   * If the @b val is not in the set, insert it and return true.
+   * Otherwise, return false.
+   */
+  bool insert(Val val)
+  { return _map.insert(val, EmptyStruct()); }
+
+  /**
+   * If @b val is in the set, remove it and return true.
+   * Otherwise, return false.
+   */
+  bool remove(Val val)
+  { return _map.remove(val); }
+
+  /** Return number of elements in the set */
+  unsigned size() const
+  { return _map.size(); }
+
+  /** Return true iff the set is empty */
+  bool isEmpty() const
+  { return _map.isEmpty(); }
+
+  /**
+   * Class to allow iteration over elements of the set.
+   */
+  class Iterator {
+  public:
+    Iterator(const SwissSet& set) : _mit(set._map) {}
+
+    bool hasNext()
+    { return _mit.hasNext(); }
+
+    /**
+     * Return the next element
+     * @warning hasNext() must have been called before
+     */
+    Val next()
+    { return _mit.nextKey(); }
+
+  private:
+    typename SwissMap<Val,EmptyStruct,Hash>::Iterator _mit;
+  };
+
+private:
+  SwissMap<Val,EmptyStruct,Hash> _map;
+}; // class SwissSet
+
+}
+
+#endif // __SwissMap__
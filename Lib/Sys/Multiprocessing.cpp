@@ -138,7 +138,7 @@ void Multiprocessing::killNoCheck(pid_t child, int signal)
   ::kill(child, signal);
 }
 
-pid_t Multiprocessing::poll_children(bool &exited, bool &signalled, int &code)
+pid_t Multiprocessing::poll_children(bool &exited, bool &signalled, bool &stopped, int &code)
 {
   int status;
   pid_t pid = waitpid(-1 /*wait for any child*/, &status, WUNTRACED);
@@ -149,6 +149,7 @@ pid_t Multiprocessing::poll_children(bool &exited, bool &signalled, int &code)
 
   exited = WIFEXITED(status);
   signalled = WIFSIGNALED(status);
+  stopped = WIFSTOPPED(status);
   if(exited)
   {
     code = WEXITSTATUS(status);
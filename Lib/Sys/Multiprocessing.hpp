@@ -31,7 +31,7 @@ public:
 
   void kill(pid_t child, int signal);
   void killNoCheck(pid_t child, int signal);
-  pid_t poll_children(bool &exited, bool &signalled, int &code);
+  pid_t poll_children(bool &exited, bool &signalled, bool &stopped, int &code);
 private:
   Multiprocessing();
   ~Multiprocessing();
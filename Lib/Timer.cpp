@@ -42,6 +42,8 @@ using namespace std;
 // not sure it's worth assertion-failing over
 std::atomic<int> timer_sigalrm_counter{-1};
 std::atomic<bool> Timer::s_limitEnforcement{true};
+std::atomic<bool> Timer::s_pauseAtLimit{false};
+std::atomic<int> Timer::s_pausedMilliseconds{0};
 
 // TODO probably these should also be atomics, but not sure
 #ifdef __linux__
@@ -61,6 +63,16 @@ unsigned Timer::elapsedMegaInstructions() {
 #endif
 }
 
+long long Timer::elapsedInstructions() {
+#ifdef __linux__
+  long long count;
+  if (perf_fd >= 0 && read(perf_fd, &count, sizeof(long long)) == sizeof(long long)) {
+    return count;
+  }
+#endif
+  return -1;
+}
+
 [[noreturn]] void Timer::limitReached(unsigned char whichLimit)
 {
   using namespace Shell;
@@ -106,6 +118,36 @@ unsigned Timer::elapsedMegaInstructions() {
   System::terminateImmediately(1);
 }
 
+/**
+ * Stop the process at a reached limit (1 for time, 2 for instructions), leaving it to the parent
+ * to either resume it (with SIGCONT) or kill it. Once resumed, carry on with the limit doubled.
+ * Used for portfolio slices which may be continued later (see --portfolio_paused_slices).
+ *
+ * The time spent stopped is not counted, so that syncClock does not charge it to the slice.
+ */
+void Timer::pauseAtLimit(unsigned char whichLimit)
+{
+  // we may be in the signal handler, so nothing that could allocate here
+  int stoppedAt = guaranteedMilliseconds();
+  raise(SIGSTOP);
+  int resumedAt = guaranteedMilliseconds();
+  if (stoppedAt != -1 && resumedAt != -1) {
+    s_pausedMilliseconds += resumedAt - stoppedAt;
+  }
+
+  if (whichLimit == 1) {
+    env.options->setTimeLimitInDeciseconds(2*env.options->timeLimitInDeciseconds());
+    // set by Environment::timeLimitReached
+    env.statistics->terminationReason = Shell::Statistics::UNKNOWN;
+  }
+#ifdef __linux__
+  else {
+    env.options->setInstructionLimit(2*env.options->instructionLimit());
+  }
+#endif
+  Timer::setLimitEnforcement(true);
+}
+
 void
 timer_sigalrm_handler (int sig)
 {
@@ -119,7 +161,9 @@ timer_sigalrm_handler (int sig)
   timer_sigalrm_counter++;
 
   if(Timer::s_limitEnforcement && env.timeLimitReached()) {
-    if (TimeoutProtector::protectingTimeout) {
+    if (Timer::s_pauseAtLimit) {
+      Timer::pauseAtLimit(1);
+    } else if (TimeoutProtector::protectingTimeout) {
       TimeoutProtector::callLimitReachedLater = 1; // 1 for a time limit
     } else {
       Timer::limitReached(1); // 1 for a time limit
@@ -135,7 +179,9 @@ timer_sigalrm_handler (int sig)
 
       if (env.options->instructionLimit() && last_instruction_count_read >= MEGA*(long long)env.options->instructionLimit()) {
         Timer::setLimitEnforcement(false);
-        if (TimeoutProtector::protectingTimeout) {
+        if (Timer::s_pauseAtLimit) {
+          Timer::pauseAtLimit(2);
+        } else if (TimeoutProtector::protectingTimeout) {
           TimeoutProtector::callLimitReachedLater = 2; // 2 for an instr limit
         } else {
           Timer::limitReached(2); // 2 for an instr limit
@@ -323,7 +369,7 @@ void Timer::syncClock()
     return;
   }
 
-  int newVal=newMilliseconds-s_initGuarantedMiliseconds;
+  int newVal=newMilliseconds-s_initGuarantedMiliseconds-s_pausedMilliseconds;
   if(abs(newVal-timer_sigalrm_counter)>20) {
     timer_sigalrm_counter=newVal;
   }
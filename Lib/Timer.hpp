@@ -96,12 +96,22 @@ public:
   // (when instruction counting is supported and an instruction limit is set)
   static bool instructionLimitingInPlace();
   static unsigned elapsedMegaInstructions();
+  // reads the (user) instruction counter right now, -1 if instruction counting is not supported
+  static long long elapsedInstructions();
   static void resetInstructionMeasuring();
 
   // called when a limit is reached
   [[noreturn]] static void limitReached(unsigned char whichLimit);
 
+  // instead of terminating at a limit, stop the process and continue with the limit doubled once resumed
+  static void setPauseAtLimit(bool enabled)
+  { s_pauseAtLimit = enabled; }
+  static void pauseAtLimit(unsigned char whichLimit);
+
   static std::atomic<bool> s_limitEnforcement;
+  static std::atomic<bool> s_pauseAtLimit;
+  /** time spent stopped in pauseAtLimit, which syncClock leaves out */
+  static std::atomic<int> s_pausedMilliseconds;
 private:
   /** true if the timer is running */
   bool _running;
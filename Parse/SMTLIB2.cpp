@@ -66,16 +66,47 @@ SMTLIB2::SMTLIB2(const Options& opts)
   _logic(SMT_UNDEFINED),
   _numeralsAreReal(false),
   _formulas(nullptr),
-  _topLevelExpr(nullptr)
+  _topLevelExpr(nullptr),
+  _afterCheckSat(false),
+  _exited(false)
 {
 }
 
+/**
+ * Read the benchmark one top-level command at a time, so that the expressions
+ * of the (typically large) assertions can be released as soon as they have
+ * been turned into formulas, instead of keeping the whole file in memory.
+ */
 void SMTLIB2::parse(istream& str)
 {
   LispLexer lex(str);
   LispParser lpar(lex);
-  LExpr* expr = lpar.parse();
-  parse(expr);
+
+  while (LExpr* lexp = lpar.parseNext()) {
+    if (!readCommand(lexp)) {
+      if (_exited) {
+        if (LExpr* rest = lpar.parseNext()) {
+          LExpr::destroy(rest);
+          USER_ERROR("exit should be the last command of the benchmark");
+        }
+      } else {
+        // the skipped rest after check-sat must still be well-formed,
+        // as it was when the whole benchmark was parsed up front
+        while (LExpr* rest = lpar.parseNext()) {
+          LExpr::destroy(rest);
+        }
+      }
+      break;
+    }
+    // only assertions are guaranteed to keep no references into their expressions
+    if (lexp->isList() && lexp->list && lexp->list->head()->isAtom()) {
+      const vstring& cmd = lexp->list->head()->str;
+      if (cmd == "assert" || cmd == "assert-not" || cmd == "assert-theory") {
+        _topLevelExpr = nullptr;
+        LExpr::destroy(lexp);
+      }
+    }
+  }
 }
 
 void SMTLIB2::parse(LExpr* bench)
@@ -88,312 +119,317 @@ void SMTLIB2::readBenchmark(LExprList* bench)
 {
   LispListReader bRdr(bench);
 
-  bool afterCheckSat = false;
-
   // iteration over benchmark top level entries
   while(bRdr.hasNext()) {
-    LExpr* lexp = bRdr.next();
-    _topLevelExpr = lexp;
-    _nextVar = 0;
-
-    LOG2("readBenchmark ",lexp->toString(true));
+    if (!readCommand(bRdr.next())) {
+      if (_exited) {
+        bRdr.acceptEOL(); // exit should be the last thing in the file
+      }
+      break;
+    }
+  }
+}
 
+bool SMTLIB2::readCommand(LExpr* lexp)
+{
+  // the main dispatch below stops at the first check-sat,
+  // however, we want to learn about an unsat core printing request
+  // (or other things we might support in the future)
+  if (_afterCheckSat) {
     LispListReader ibRdr(lexp);
 
-    if (ibRdr.tryAcceptAtom("set-logic")) {
-      if (_logicSet) {
-        USER_ERROR_EXPR("set-logic can appear only once in a problem");
-      }
-      readLogic(ibRdr.readAtom());
-      ibRdr.acceptEOL();
-      continue;
+    if (ibRdr.tryAcceptAtom("exit")) {
+      ibRdr.acceptEOL(); // no arguments of exit
+      _exited = true;
+      return false;
     }
 
-    if (ibRdr.tryAcceptAtom("set-info")) {
+    if (ibRdr.tryAcceptAtom("get-unsat-core")) {
+      env.options->setOutputMode(Options::Output::UCORE);
+      ibRdr.acceptEOL(); // no arguments of get-unsat-core
+      return true;
+    }
 
-      if (ibRdr.tryAcceptAtom(":status")) {
-        _statusStr = ibRdr.readAtom();
-        ibRdr.acceptEOL();
-        continue;
-      }
+    // can't read anything else (and it does not make sense to read get-unsat-core more than once)
+    // so let's just warn and exit
+    if(env.options->mode()!=Options::Mode::SPIDER) {
+      env.beginOutput();
+      env.out() << "% Warning: check-sat is not the last entry. Skipping the rest!" << endl;
+      env.endOutput();
+    }
+    return false;
+  }
 
-      if (ibRdr.tryAcceptAtom(":source")) {
-        _sourceInfo = ibRdr.readAtom();
-        ibRdr.acceptEOL();
-        continue;
-      }
+  _topLevelExpr = lexp;
+  _nextVar = 0;
 
-      // ignore unknown info
-      ibRdr.readAtom();
-      ibRdr.readAtom();
-      ibRdr.acceptEOL();
-      continue;
+  LOG2("readBenchmark ",lexp->toString(true));
+
+  LispListReader ibRdr(lexp);
+
+  if (ibRdr.tryAcceptAtom("set-logic")) {
+    if (_logicSet) {
+      USER_ERROR_EXPR("set-logic can appear only once in a problem");
     }
+    readLogic(ibRdr.readAtom());
+    ibRdr.acceptEOL();
+    return true;
+  }
 
-    if (ibRdr.tryAcceptAtom("declare-sort")) {
-      vstring name = ibRdr.readAtom();
-      vstring arity;
-      if (!ibRdr.tryReadAtom(arity)) {
-        USER_ERROR_EXPR("Unspecified arity while declaring sort: "+name);
-      }
+  if (ibRdr.tryAcceptAtom("set-info")) {
 
-      readDeclareSort(name,arity);
+    if (ibRdr.tryAcceptAtom(":status")) {
+      _statusStr = ibRdr.readAtom();
+      ibRdr.acceptEOL();
+      return true;
+    }
 
+    if (ibRdr.tryAcceptAtom(":source")) {
+      _sourceInfo = ibRdr.readAtom();
       ibRdr.acceptEOL();
+      return true;
+    }
+
+    // ignore unknown info
+    ibRdr.readAtom();
+    ibRdr.readAtom();
+    ibRdr.acceptEOL();
+    return true;
+  }
 
-      continue;
+  if (ibRdr.tryAcceptAtom("declare-sort")) {
+    vstring name = ibRdr.readAtom();
+    vstring arity;
+    if (!ibRdr.tryReadAtom(arity)) {
+      USER_ERROR_EXPR("Unspecified arity while declaring sort: "+name);
     }
 
-    if (ibRdr.tryAcceptAtom("define-sort")) {
-      vstring name = ibRdr.readAtom();
-      LExprList* args = ibRdr.readList();
+    readDeclareSort(name,arity);
 
-      if (!ibRdr.hasNext()) {
-        USER_ERROR_EXPR("define-sort expects a sort definition body");
-      }
-      LExpr* body = ibRdr.readNext();
+    ibRdr.acceptEOL();
 
-      readDefineSort(name,args,body);
+    return true;
+  }
 
-      ibRdr.acceptEOL();
+  if (ibRdr.tryAcceptAtom("define-sort")) {
+    vstring name = ibRdr.readAtom();
+    LExprList* args = ibRdr.readList();
 
-      continue;
+    if (!ibRdr.hasNext()) {
+      USER_ERROR_EXPR("define-sort expects a sort definition body");
     }
+    LExpr* body = ibRdr.readNext();
 
-    if (ibRdr.tryAcceptAtom("declare-fun")) {
-      vstring name = ibRdr.readAtom();
-      LExprList* iSorts = ibRdr.readList();
-      LispListReader iSortRdr(iSorts);
-      auto lookup = new TermLookup();
-      _scopes.push(lookup);
-      if (iSortRdr.hasNext() && iSortRdr.peekAtNext()->isAtom() && iSortRdr.peekAtNext()->str == PAR) {
-        ibRdr.acceptEOL();
-        iSortRdr.readAtom(); // the "par" atom
-        readTypeParameters(iSortRdr, lookup);
-        iSorts = iSortRdr.readList();
-        ibRdr = iSortRdr;
-      }
-      if (!ibRdr.hasNext()) {
-        USER_ERROR_EXPR("declare-fun expects an output sort");
-      }
-      LExpr* oSort = ibRdr.readNext();
+    readDefineSort(name,args,body);
 
-      readDeclareFun(name,iSorts,oSort,lookup->size());
+    ibRdr.acceptEOL();
 
-      ibRdr.acceptEOL();
-      delete _scopes.pop();
+    return true;
+  }
 
-      continue;
+  if (ibRdr.tryAcceptAtom("declare-fun")) {
+    vstring name = ibRdr.readAtom();
+    LExprList* iSorts = ibRdr.readList();
+    LispListReader iSortRdr(iSorts);
+    auto lookup = new TermLookup();
+    _scopes.push(lookup);
+    if (iSortRdr.hasNext() && iSortRdr.peekAtNext()->isAtom() && iSortRdr.peekAtNext()->str == PAR) {
+      ibRdr.acceptEOL();
+      iSortRdr.readAtom(); // the "par" atom
+      readTypeParameters(iSortRdr, lookup);
+      iSorts = iSortRdr.readList();
+      ibRdr = iSortRdr;
+    }
+    if (!ibRdr.hasNext()) {
+      USER_ERROR_EXPR("declare-fun expects an output sort");
     }
+    LExpr* oSort = ibRdr.readNext();
 
-    if (ibRdr.tryAcceptAtom("declare-datatype")) {
-      LExpr *sort = ibRdr.readNext();
-      LExprList *datatype = ibRdr.readList();
+    readDeclareFun(name,iSorts,oSort,lookup->size());
 
-      readDeclareDatatype(sort, datatype);
+    ibRdr.acceptEOL();
+    delete _scopes.pop();
 
-      ibRdr.acceptEOL();
+    return true;
+  }
 
-      continue;
-    }
+  if (ibRdr.tryAcceptAtom("declare-datatype")) {
+    LExpr *sort = ibRdr.readNext();
+    LExprList *datatype = ibRdr.readList();
 
-    if (ibRdr.tryAcceptAtom("declare-datatypes")) {
-      LExprList* sorts = ibRdr.readList();
-      LExprList* datatypes = ibRdr.readList();
+    readDeclareDatatype(sort, datatype);
 
-      readDeclareDatatypes(sorts, datatypes, false);
+    ibRdr.acceptEOL();
 
-      ibRdr.acceptEOL();
+    return true;
+  }
 
-      continue;
-    }
+  if (ibRdr.tryAcceptAtom("declare-datatypes")) {
+    LExprList* sorts = ibRdr.readList();
+    LExprList* datatypes = ibRdr.readList();
 
-    if (ibRdr.tryAcceptAtom("declare-codatatypes")) {
-      LExprList* sorts = ibRdr.readList();
-      LExprList* datatypes = ibRdr.readList();
+    readDeclareDatatypes(sorts, datatypes, false);
 
-      readDeclareDatatypes(sorts, datatypes, true);
+    ibRdr.acceptEOL();
 
-      ibRdr.acceptEOL();
-
-      continue;
-    }
-    
-    if (ibRdr.tryAcceptAtom("declare-const")) {
-      vstring name = ibRdr.readAtom();
-      if (!ibRdr.hasNext()) {
-        USER_ERROR_EXPR("declare-const expects a const definition body");
-      }
-      LExpr* oSort = ibRdr.readNext();
-      auto lookup = new TermLookup();
-      _scopes.push(lookup);
-      if (oSort->isList()) {
-        LispListReader oSortRdr(oSort);
-        if (oSortRdr.hasNext() && oSortRdr.peekAtNext()->isAtom() && oSortRdr.peekAtNext()->str == PAR) {
-          ibRdr.acceptEOL();
-          oSortRdr.readAtom(); // the "par" atom
-          readTypeParameters(oSortRdr, lookup);
-          oSort = oSortRdr.readNext();
-          ibRdr = oSortRdr;
-        }
-      }
+    return true;
+  }
 
-      readDeclareFun(name,nullptr,oSort,lookup->size());
+  if (ibRdr.tryAcceptAtom("declare-codatatypes")) {
+    LExprList* sorts = ibRdr.readList();
+    LExprList* datatypes = ibRdr.readList();
 
-      ibRdr.acceptEOL();
-      delete _scopes.pop();
+    readDeclareDatatypes(sorts, datatypes, true);
 
-      continue;
-    }
+    ibRdr.acceptEOL();
 
-    bool recursive = false;
-    if (ibRdr.tryAcceptAtom("define-fun") || (recursive = ibRdr.tryAcceptAtom("define-fun-rec"))) {
-      vstring name = ibRdr.readAtom();
-      LExprList* iArgs = ibRdr.readList();
-      LispListReader iArgRdr(iArgs);
-      auto lookup = new TermLookup();
-      TermStack typeArgs;
-      _scopes.push(lookup);
-      if (iArgRdr.hasNext() && iArgRdr.peekAtNext()->isAtom() && iArgRdr.peekAtNext()->str == PAR) {
+    return true;
+  }
+  
+  if (ibRdr.tryAcceptAtom("declare-const")) {
+    vstring name = ibRdr.readAtom();
+    if (!ibRdr.hasNext()) {
+      USER_ERROR_EXPR("declare-const expects a const definition body");
+    }
+    LExpr* oSort = ibRdr.readNext();
+    auto lookup = new TermLookup();
+    _scopes.push(lookup);
+    if (oSort->isList()) {
+      LispListReader oSortRdr(oSort);
+      if (oSortRdr.hasNext() && oSortRdr.peekAtNext()->isAtom() && oSortRdr.peekAtNext()->str == PAR) {
         ibRdr.acceptEOL();
-        iArgRdr.readAtom(); // the "par" atom
-        readTypeParameters(iArgRdr, lookup, &typeArgs);
-        iArgs = iArgRdr.readList();
-        ibRdr = iArgRdr;
-      }
-      if (!ibRdr.hasNext()) {
-        USER_ERROR_EXPR("define-fun expects an output sort");
-      }
-      LExpr* oSort = ibRdr.readNext();
-      if (!ibRdr.hasNext()) {
-        USER_ERROR_EXPR("define-fun expects a fun definition body");
+        oSortRdr.readAtom(); // the "par" atom
+        readTypeParameters(oSortRdr, lookup);
+        oSort = oSortRdr.readNext();
+        ibRdr = oSortRdr;
       }
-      LExpr* body = ibRdr.readNext();
+    }
 
-      readDefineFun(name,iArgs,oSort,body,typeArgs,recursive);
+    readDeclareFun(name,nullptr,oSort,lookup->size());
 
-      ibRdr.acceptEOL();
-      delete _scopes.pop();
+    ibRdr.acceptEOL();
+    delete _scopes.pop();
+
+    return true;
+  }
 
-      continue;
+  bool recursive = false;
+  if (ibRdr.tryAcceptAtom("define-fun") || (recursive = ibRdr.tryAcceptAtom("define-fun-rec"))) {
+    vstring name = ibRdr.readAtom();
+    LExprList* iArgs = ibRdr.readList();
+    LispListReader iArgRdr(iArgs);
+    auto lookup = new TermLookup();
+    TermStack typeArgs;
+    _scopes.push(lookup);
+    if (iArgRdr.hasNext() && iArgRdr.peekAtNext()->isAtom() && iArgRdr.peekAtNext()->str == PAR) {
+      ibRdr.acceptEOL();
+      iArgRdr.readAtom(); // the "par" atom
+      readTypeParameters(iArgRdr, lookup, &typeArgs);
+      iArgs = iArgRdr.readList();
+      ibRdr = iArgRdr;
+    }
+    if (!ibRdr.hasNext()) {
+      USER_ERROR_EXPR("define-fun expects an output sort");
+    }
+    LExpr* oSort = ibRdr.readNext();
+    if (!ibRdr.hasNext()) {
+      USER_ERROR_EXPR("define-fun expects a fun definition body");
     }
+    LExpr* body = ibRdr.readNext();
 
-    if (ibRdr.tryAcceptAtom("assert")) {
-      if (!ibRdr.hasNext()) {
-        USER_ERROR_EXPR("assert expects a body");
-      }
-      LExpr* body = ibRdr.readNext();
-      readAssert(body);
+    readDefineFun(name,iArgs,oSort,body,typeArgs,recursive);
 
-      ibRdr.acceptEOL();
+    ibRdr.acceptEOL();
+    delete _scopes.pop();
 
-      continue;
+    return true;
+  }
+
+  if (ibRdr.tryAcceptAtom("assert")) {
+    if (!ibRdr.hasNext()) {
+      USER_ERROR_EXPR("assert expects a body");
     }
+    LExpr* body = ibRdr.readNext();
+    readAssert(body);
 
-    if (ibRdr.tryAcceptAtom("assert-not")) {
-      if (!ibRdr.hasNext()) {
-        USER_ERROR_EXPR("assert-not expects a body");
-      }
-      LExpr* body = ibRdr.readNext();
-      readAssertNot(body);
+    ibRdr.acceptEOL();
 
-      ibRdr.acceptEOL();
+    return true;
+  }
 
-      continue;
+  if (ibRdr.tryAcceptAtom("assert-not")) {
+    if (!ibRdr.hasNext()) {
+      USER_ERROR_EXPR("assert-not expects a body");
     }
+    LExpr* body = ibRdr.readNext();
+    readAssertNot(body);
 
-    if (ibRdr.tryAcceptAtom("assert-theory")) {
-      if (!ibRdr.hasNext()) {
-        USER_ERROR_EXPR("assert-theory expects a body");
-      }
-      LExpr* body = ibRdr.readNext();
-      readAssertTheory(body);
+    ibRdr.acceptEOL();
 
-      ibRdr.acceptEOL();
+    return true;
+  }
 
-      continue;
+  if (ibRdr.tryAcceptAtom("assert-theory")) {
+    if (!ibRdr.hasNext()) {
+      USER_ERROR_EXPR("assert-theory expects a body");
     }
+    LExpr* body = ibRdr.readNext();
+    readAssertTheory(body);
 
-    // not an official SMTLIB command
-    if (ibRdr.tryAcceptAtom("color-symbol")) {
-      vstring symbol = ibRdr.readAtom();
+    ibRdr.acceptEOL();
 
-      if (ibRdr.tryAcceptAtom(":left")) {
-        colorSymbol(symbol, Color::COLOR_LEFT);
-      } else if (ibRdr.tryAcceptAtom(":right")) {
-        colorSymbol(symbol, Color::COLOR_RIGHT);
-      } else {
-        USER_ERROR_EXPR("'"+ibRdr.readAtom()+"' is not a color keyword");
-      }
+    return true;
+  }
 
-      ibRdr.acceptEOL();
+  // not an official SMTLIB command
+  if (ibRdr.tryAcceptAtom("color-symbol")) {
+    vstring symbol = ibRdr.readAtom();
 
-      continue;
+    if (ibRdr.tryAcceptAtom(":left")) {
+      colorSymbol(symbol, Color::COLOR_LEFT);
+    } else if (ibRdr.tryAcceptAtom(":right")) {
+      colorSymbol(symbol, Color::COLOR_RIGHT);
+    } else {
+      USER_ERROR_EXPR("'"+ibRdr.readAtom()+"' is not a color keyword");
     }
 
-    if (ibRdr.tryAcceptAtom("check-sat")) {
-      ibRdr.acceptEOL();
-      afterCheckSat = true;
-      break;
-    }
+    ibRdr.acceptEOL();
 
-    if (ibRdr.tryAcceptAtom("exit")) {
-      bRdr.acceptEOL();
-      break;
-    }
+    return true;
+  }
 
-    if (ibRdr.tryAcceptAtom("reset")) {
-      LOG1("ignoring reset");
-      continue;
-    }
+  if (ibRdr.tryAcceptAtom("check-sat")) {
+    ibRdr.acceptEOL();
+    _afterCheckSat = true;
+    return true;
+  }
 
-    if (ibRdr.tryAcceptAtom("set-option")) {
-      LOG2("ignoring set-option", ibRdr.readAtom());
-      continue;
-    }
+  if (ibRdr.tryAcceptAtom("exit")) {
+    _exited = true;
+    return false;
+  }
 
-    if (ibRdr.tryAcceptAtom("push")) {
-      LOG1("ignoring push");
-      continue;
-    }
+  if (ibRdr.tryAcceptAtom("reset")) {
+    LOG1("ignoring reset");
+    return true;
+  }
 
-    if (ibRdr.tryAcceptAtom("get-info")) {
-      LOG2("ignoring get-info", ibRdr.readAtom());
-      continue;
-    }
+  if (ibRdr.tryAcceptAtom("set-option")) {
+    LOG2("ignoring set-option", ibRdr.readAtom());
+    return true;
+  }
 
-    USER_ERROR_EXPR("unrecognized entry "+ibRdr.readAtom());
+  if (ibRdr.tryAcceptAtom("push")) {
+    LOG1("ignoring push");
+    return true;
   }
-  
-  // the above while loop is aborted on the first check-sat,
-  // however, we want to learn about an unsat core printing request
-  // (or other things we might support in the future)
-  if (afterCheckSat) {
-    while(bRdr.hasNext()) {
-      LispListReader ibRdr(bRdr.next());
-      
-      if (ibRdr.tryAcceptAtom("exit")) {
-        ibRdr.acceptEOL(); // no arguments of exit
-        bRdr.acceptEOL();  // exit should be the last thing in the file
-        break;
-      }
-      
-      if (ibRdr.tryAcceptAtom("get-unsat-core")) {
-        env.options->setOutputMode(Options::Output::UCORE);
-        ibRdr.acceptEOL(); // no arguments of get-unsat-core
-        continue;
-      }
-      
-      // can't read anything else (and it does not make sense to read get-unsat-core more than once)
-      // so let's just warn and exit
-      if(env.options->mode()!=Options::Mode::SPIDER) {
-        env.beginOutput();
-        env.out() << "% Warning: check-sat is not the last entry. Skipping the rest!" << endl;
-        env.endOutput();
-      }
-      break;
-    }
+
+  if (ibRdr.tryAcceptAtom("get-info")) {
+    LOG2("ignoring get-info", ibRdr.readAtom());
+    return true;
   }
+
+  USER_ERROR_EXPR("unrecognized entry "+ibRdr.readAtom());
 }
 
 //  ----------------------------------------------------------------------
@@ -481,10 +481,22 @@ private:
    */
   LExpr* _topLevelExpr;
 
+  /** Set once check-sat has been read; only few commands are understood afterwards. */
+  bool _afterCheckSat;
+
+  /** Set once exit has been read; nothing may follow it. */
+  bool _exited;
+
   /**
    * Toplevel parsing dispatch for a benchmark.
    */
   void readBenchmark(LExprList* bench);
+
+  /**
+   * Toplevel parsing dispatch for a single command of a benchmark.
+   * Returns false if the remaining commands should not be read.
+   */
+  bool readCommand(LExpr* lexp);
 };
 
 }
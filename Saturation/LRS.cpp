@@ -51,7 +51,9 @@ void LRS::onUnprocessedSelected(Clause* c)
   if(shouldUpdateLimits()) {
     TIME_TRACE("LRS limit maintenance");
 
-    long long estimatedReachable=estimatedReachableCount();
+    long long estimatedReachable = (_opt.lrsInstructionRate() && Timer::instructionLimitingInPlace())
+        ? estimatedReachableCountByInstructions()
+        : estimatedReachableCount();
     if(estimatedReachable>=0) {
       _passive->updateLimits(estimatedReachable);
       if(!_limitsEverActive) {
@@ -163,4 +165,53 @@ long long LRS::estimatedReachableCount()
   return result;
 }
 
+/**
+ * Like estimatedReachableCount, but entirely in terms of executed instructions
+ * (see --lrs_instruction_rate), so that the estimate does not depend on
+ * the load of the machine and is the same in every run.
+ *
+ * The time limit is turned into an instruction budget at the given rate and
+ * the cost of an activation is re-estimated on each call, averaging it
+ * with the cost of the activations since the previous call.
+ */
+long long LRS::estimatedReachableCountByInstructions()
+{
+  long long instrs = Timer::elapsedInstructions();
+  if (instrs < 0) {
+    return -1;
+  }
+
+  // the rate is in mega-instructions per second
+  const long long mega = 1 << 20;
+  long long budget = 0;
+  int timeLimitDeci = _opt.simulatedTimeLimit() ? _opt.simulatedTimeLimit() : _opt.timeLimitInDeciseconds();
+  if (timeLimitDeci) {
+    budget = mega*timeLimitDeci*_opt.lrsInstructionRate()/10;
+  }
+  long long instrLimit = 0;
+#ifdef __linux__
+  instrLimit = mega*(_opt.simulatedInstructionLimit() ? _opt.simulatedInstructionLimit() : _opt.instructionLimit());
+#endif
+  if (instrLimit && (!budget || instrLimit < budget)) {
+    budget = instrLimit;
+  }
+
+  long long processed = env.statistics->activeClauses;
+  if (_lastInstructions >= 0 && processed > _lastProcessed) {
+    double recent = double(instrs-_lastInstructions)/(processed-_lastProcessed);
+    _instructionsPerActivation = _instructionsPerActivation ? (_instructionsPerActivation+recent)/2 : recent;
+  }
+  _lastInstructions = instrs;
+  _lastProcessed = processed;
+
+  if (!budget || instrs*100 < _opt.lrsFirstTimeCheck()*budget || processed <= 10 || !_instructionsPerActivation) {
+    return -1;
+  }
+  long long instrsLeft = budget - instrs;
+  if (instrsLeft <= 0) {
+    return -1;
+  }
+  return _opt.lrsEstimateCorrectionCoef()*instrsLeft/_instructionsPerActivation;
+}
+
 }
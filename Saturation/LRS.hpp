@@ -34,7 +34,8 @@ public:
   USE_ALLOCATOR(LRS);
 
   LRS(Problem& prb, const Options& opt)
-  : Otter(prb, opt), _limitsEverActive(false) {}
+  : Otter(prb, opt), _limitsEverActive(false),
+    _lastInstructions(-1), _lastProcessed(0), _instructionsPerActivation(0) {}
 
 
 protected:
@@ -48,8 +49,15 @@ protected:
   bool shouldUpdateLimits();
 
   long long estimatedReachableCount();
+  long long estimatedReachableCountByInstructions();
 
   bool _limitsEverActive;
+
+  /** instructions executed and clauses activated at the previous estimate by instructions */
+  long long _lastInstructions;
+  long long _lastProcessed;
+  /** running estimate of the instructions spent per activation */
+  double _instructionsPerActivation;
 };
 
 };
@@ -0,0 +1,309 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file LearnedPassiveClauseContainer.cpp
+ * Implements the class LearnedPassiveClauseContainer
+ */
+
+#include <fstream>
+#include <sstream>
+
+#include "Debug/TimeProfiling.hpp"
+
+#include "Lib/Environment.hpp"
+#include "Lib/Exception.hpp"
+#include "Lib/Int.hpp"
+#include "Lib/SharedSet.hpp"
+#include "Kernel/Inference.hpp"
+#include "Kernel/Term.hpp"
+#include "Shell/Options.hpp"
+
+#include "LearnedPassiveClauseContainer.hpp"
+
+namespace Saturation
+{
+using namespace std;
+using namespace Lib;
+using namespace Kernel;
+
+const unsigned ClauseScoringModel::NUM_FEATURES;
+const unsigned ClauseScoringModel::BATCH_SIZE;
+
+ClauseScoringModel::ClauseScoringModel(const vstring& fileName)
+{
+  ifstream file(fileName.c_str());
+  if (file.fail()) {
+    USER_ERROR("Cannot open clause selection model file: "+fileName);
+  }
+
+  // drop the comments, everything else is whitespace separated
+  stringstream tokens;
+  string line;
+  while (getline(file, line)) {
+    tokens << line.substr(0, line.find('#')) << '\n';
+  }
+
+  string key;
+  unsigned inputs;
+  if (!(tokens >> key >> inputs) || key != "inputs" || !(tokens >> key >> _hidden) || key != "hidden") {
+    USER_ERROR("Clause selection model file "+fileName+" must start with 'inputs <n> hidden <n>'");
+  }
+  if (inputs != NUM_FEATURES) {
+    USER_ERROR("Clause selection model file "+fileName+" has "+Int::toString(inputs)+
+        " inputs, but "+Int::toString(NUM_FEATURES)+" clause features are computed");
+  }
+
+  auto readArray = [&](DArray<float>& arr, unsigned size) {
+    arr.init(size, 0.0f);
+    for (unsigned i = 0; i < size; i++) {
+      if (!(tokens >> arr[i])) {
+        USER_ERROR("Clause selection model file "+fileName+" has fewer weights than its dimensions require");
+      }
+    }
+  };
+  readArray(_hiddenWeights, _hidden*NUM_FEATURES);
+  readArray(_hiddenBiases, _hidden);
+  readArray(_outWeights, _hidden ? _hidden : NUM_FEATURES);
+  if (!(tokens >> _outBias)) {
+    USER_ERROR("Clause selection model file "+fileName+" has fewer weights than its dimensions require");
+  }
+  if (tokens >> key) {
+    USER_ERROR("Clause selection model file "+fileName+" has more weights than its dimensions require");
+  }
+}
+
+static unsigned termDepth(TermList t)
+{
+  if (t.isVar()) {
+    return 0;
+  }
+  unsigned res = 0;
+  for (TermList* arg = t.term()->args(); arg->isNonEmpty(); arg = arg->next()) {
+    res = max(res, termDepth(*arg));
+  }
+  return res+1;
+}
+
+void ClauseScoringModel::computeFeatures(Clause* cl, float* column)
+{
+  unsigned depth = 0;
+  unsigned equalities = 0;
+  for (unsigned i = 0; i < cl->length(); i++) {
+    Literal* lit = (*cl)[i];
+    if (lit->isEquality()) {
+      equalities++;
+    }
+    for (TermList* arg = lit->args(); arg->isNonEmpty(); arg = arg->next()) {
+      depth = max(depth, termDepth(*arg));
+    }
+  }
+
+  const Inference& inf = cl->inference();
+  float features[NUM_FEATURES] = {
+    (float)cl->weight(),
+    (float)cl->age(),
+    (float)cl->length(),
+    (float)cl->numPositiveLiterals(),
+    (float)cl->varCnt(),
+    (float)depth,
+    (float)equalities,
+    inf.derivedFromGoal() ? 1.0f : 0.0f,
+    (float)inf.getSineLevel(),
+    (float)cl->splitWeight()
+  };
+  for (unsigned f = 0; f < NUM_FEATURES; f++) {
+    column[f*BATCH_SIZE] = features[f];
+  }
+}
+
+/**
+ * All the inner loops run over the whole batch, which the compiler can turn
+ * into vector arithmetic
+ */
+void ClauseScoringModel::score(const float* features, float* scores) const
+{
+  for (unsigned b = 0; b < BATCH_SIZE; b++) {
+    scores[b] = _outBias;
+  }
+
+  if (!_hidden) {
+    for (unsigned f = 0; f < NUM_FEATURES; f++) {
+      float w = _outWeights[f];
+      const float* x = features + f*BATCH_SIZE;
+      for (unsigned b = 0; b < BATCH_SIZE; b++) {
+        scores[b] += w*x[b];
+      }
+    }
+    return;
+  }
+
+  float acc[BATCH_SIZE];
+  for (unsigned h = 0; h < _hidden; h++) {
+    for (unsigned b = 0; b < BATCH_SIZE; b++) {
+      acc[b] = _hiddenBiases[h];
+    }
+    for (unsigned f = 0; f < NUM_FEATURES; f++) {
+      float w = _hiddenWeights[h*NUM_FEATURES+f];
+      const float* x = features + f*BATCH_SIZE;
+      for (unsigned b = 0; b < BATCH_SIZE; b++) {
+        acc[b] += w*x[b];
+      }
+    }
+    float w = _outWeights[h];
+    for (unsigned b = 0; b < BATCH_SIZE; b++) {
+      scores[b] += w*max(acc[b], 0.0f);
+    }
+  }
+}
+
+/**
+ * By score, then by age and by number
+ */
+bool ScoreQueue::lessThan(Clause* c1,Clause* c2)
+{
+  float s1 = _scores.get(c1);
+  float s2 = _scores.get(c2);
+  if (s1 != s2) {
+    return s1 < s2;
+  }
+  if (c1->age() != c2->age()) {
+    return c1->age() < c2->age();
+  }
+  return c1->number() < c2->number();
+}
+
+LearnedPassiveClauseContainer::LearnedPassiveClauseContainer(bool isOutermost, const Shell::Options& opt) :
+  PassiveClauseContainer(isOutermost, opt, "LearnedQ"),
+  _model(new ClauseScoringModel(opt.clauseSelectionModel())),
+  _ageQueue(opt),
+  _scoreQueue(_scores),
+  _ageRatio(opt.ageRatio()),
+  _weightRatio(opt.weightRatio()),
+  _balance(0),
+  _size(0)
+{
+}
+
+LearnedPassiveClauseContainer::~LearnedPassiveClauseContainer()
+{
+  ClauseQueue::Iterator cit(_ageQueue);
+  while (cit.hasNext()) {
+    Clause* cl=cit.next();
+    ASS(!_isOutermost || cl->store()==Clause::PASSIVE);
+    cl->setStore(Clause::NONE);
+  }
+}
+
+void LearnedPassiveClauseContainer::add(Clause* cl)
+{
+  ASS(cl->store() == Clause::PASSIVE);
+
+  _ageQueue.insert(cl);
+  _unscored.push(cl);
+  if (_unscored.size() == ClauseScoringModel::BATCH_SIZE) {
+    scoreUnscored();
+  }
+  _size++;
+
+  if (_isOutermost) {
+    addedEvent.fire(cl);
+  }
+}
+
+void LearnedPassiveClauseContainer::remove(Clause* cl)
+{
+  if (_isOutermost) {
+    ASS(cl->store()==Clause::PASSIVE);
+  }
+
+  if (_ageQueue.remove(cl)) {
+    _size--;
+    if (_scores.find(cl)) {
+      // the queue compares by the score, so it has to go first
+      ALWAYS(_scoreQueue.remove(cl));
+      ALWAYS(_scores.remove(cl));
+    } else {
+      Clause** it = std::find(_unscored.begin(), _unscored.end(), cl);
+      ASS(it != _unscored.end());
+      std::swap(*it, _unscored.top());
+      _unscored.pop();
+    }
+  }
+
+  if (_isOutermost) {
+    removedEvent.fire(cl);
+    ASS(cl->store()!=Clause::PASSIVE);
+  }
+}
+
+void LearnedPassiveClauseContainer::scoreUnscored()
+{
+  TIME_TRACE("clause scoring");
+
+  float features[ClauseScoringModel::NUM_FEATURES*ClauseScoringModel::BATCH_SIZE];
+  float scores[ClauseScoringModel::BATCH_SIZE];
+
+  while (_unscored.isNonEmpty()) {
+    unsigned n = min<unsigned>(_unscored.size(), ClauseScoringModel::BATCH_SIZE);
+    Clause** batch = _unscored.end() - n;
+
+    // unused columns of a partial batch are just scored along
+    std::fill(std::begin(features), std::end(features), 0.0f);
+    for (unsigned b = 0; b < n; b++) {
+      ClauseScoringModel::computeFeatures(batch[b], features + b);
+    }
+    _model->score(features, scores);
+
+    for (unsigned b = 0; b < n; b++) {
+      ALWAYS(_scores.insert(batch[b], scores[b]));
+      _scoreQueue.insert(batch[b]);
+    }
+    _unscored.truncate(_unscored.size() - n);
+  }
+}
+
+Clause* LearnedPassiveClauseContainer::popSelected()
+{
+  ASS(!isEmpty());
+
+  scoreUnscored();
+
+  bool byScore;
+  if (!_ageRatio) {
+    byScore = true;
+  } else if (!_weightRatio) {
+    byScore = false;
+  } else if (_balance != 0) {
+    byScore = _balance > 0;
+  } else {
+    byScore = _ageRatio <= _weightRatio;
+  }
+
+  Clause* cl;
+  if (byScore) {
+    _balance -= _ageRatio;
+    cl = _scoreQueue.pop();
+    _ageQueue.remove(cl);
+  } else {
+    _balance += _weightRatio;
+    cl = _ageQueue.pop();
+    _scoreQueue.remove(cl);
+  }
+  ALWAYS(_scores.remove(cl));
+  _size--;
+
+  if (_isOutermost) {
+    selectedEvent.fire(cl);
+  }
+
+  return cl;
+}
+
+}
@@ -0,0 +1,164 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file LearnedPassiveClauseContainer.hpp
+ * Defines the class LearnedPassiveClauseContainer
+ */
+
+#ifndef __LearnedPassiveClauseContainer__
+#define __LearnedPassiveClauseContainer__
+
+#include "Lib/DArray.hpp"
+#include "Lib/DHMap.hpp"
+#include "Lib/ScopedPtr.hpp"
+#include "Lib/Stack.hpp"
+#include "Kernel/Clause.hpp"
+#include "Kernel/ClauseQueue.hpp"
+#include "ClauseContainer.hpp"
+#include "AWPassiveClauseContainer.hpp"
+
+namespace Saturation {
+
+using namespace Kernel;
+
+/**
+ * A small model estimating how (un)promising a clause is for selection,
+ * lower scores meaning the clause should be selected sooner.
+ *
+ * The model is either linear or a perceptron with one hidden layer of
+ * ReLU units, over the clause features of @b computeFeatures. It is read
+ * from a text file with '#' starting comments:
+ *
+ *   inputs <number of features, which must be NUM_FEATURES>
+ *   hidden <number of hidden units, 0 for a linear model>
+ *   <hidden x inputs weights, row by row> <hidden biases>
+ *   <output weights, one per hidden unit (per input if linear)> <output bias>
+ */
+class ClauseScoringModel
+{
+public:
+  CLASS_NAME(ClauseScoringModel);
+  USE_ALLOCATOR(ClauseScoringModel);
+
+  /** weight, age, length, positive literals, variables, depth, equalities, goal, sine level, splits */
+  static const unsigned NUM_FEATURES = 10;
+  /** number of clauses scored together */
+  static const unsigned BATCH_SIZE = 16;
+
+  ClauseScoringModel(const vstring& fileName);
+
+  /**
+   * Store features of @b cl in @b column[0], column[BATCH_SIZE], ...,
+   * i.e. as a column of a feature-major batch
+   */
+  static void computeFeatures(Clause* cl, float* column);
+
+  /**
+   * Compute @b scores[0..BATCH_SIZE) for the feature-major batch @b features
+   * of NUM_FEATURES*BATCH_SIZE entries
+   */
+  void score(const float* features, float* scores) const;
+
+private:
+  unsigned _hidden;
+  /** hidden x NUM_FEATURES, empty for a linear model */
+  DArray<float> _hiddenWeights;
+  DArray<float> _hiddenBiases;
+  DArray<float> _outWeights;
+  float _outBias;
+};
+
+class ScoreQueue
+  : public ClauseQueue
+{
+public:
+  ScoreQueue(const DHMap<Clause*,float>& scores) : _scores(scores) {}
+protected:
+  virtual bool lessThan(Clause*,Clause*);
+private:
+  const DHMap<Clause*,float>& _scores;
+};
+
+/**
+ * Passive clause container which alternates, in the age:weight ratio,
+ * between selecting the oldest clause and the clause best scored by
+ * a ClauseScoringModel (see --clause_selection_model).
+ *
+ * New clauses are scored in batches of ClauseScoringModel::BATCH_SIZE,
+ * at the latest when the next clause is selected. Limited resource
+ * strategy limits are not supported.
+ */
+class LearnedPassiveClauseContainer
+: public PassiveClauseContainer
+{
+public:
+  CLASS_NAME(LearnedPassiveClauseContainer);
+  USE_ALLOCATOR(LearnedPassiveClauseContainer);
+
+  LearnedPassiveClauseContainer(bool isOutermost, const Shell::Options& opt);
+  ~LearnedPassiveClauseContainer();
+
+  void add(Clause* cl) override;
+  void remove(Clause* cl) override;
+  Clause* popSelected() override;
+
+  bool isEmpty() const override { return _ageQueue.isEmpty(); }
+  unsigned sizeEstimate() const override { return _size; }
+
+private:
+  void scoreUnscored();
+
+  ScopedPtr<ClauseScoringModel> _model;
+  AgeQueue _ageQueue;
+  ScoreQueue _scoreQueue;
+  /** scores of clauses in @b _scoreQueue */
+  DHMap<Clause*,float> _scores;
+  /** clauses in @b _ageQueue waiting to be scored */
+  Stack<Clause*> _unscored;
+
+  int _ageRatio;
+  int _weightRatio;
+  /** current balance. If &lt;0 then selection by age, if &gt;0 by score */
+  int _balance;
+
+  unsigned _size;
+
+  /*
+   * LRS specific methods for computation of Limits
+   */
+public:
+  void simulationInit() override {}
+  bool simulationHasNext() override { return false; }
+  void simulationPopSelected() override {}
+
+  // returns whether at least one of the limits was tightened
+  bool setLimitsToMax() override { return false; }
+  // returns whether at least one of the limits was tightened
+  bool setLimitsFromSimulation() override { return false; }
+
+  void onLimitsUpdated() override {}
+
+  /*
+   * LRS specific methods and fields for usage of limits
+   */
+  bool ageLimited() const override { return false; }
+  bool weightLimited() const override { return false; }
+
+  bool fulfilsAgeLimit(Clause* c) const override { return true; }
+  bool fulfilsAgeLimit(unsigned w, unsigned numPositiveLiterals, const Inference& inference) const override { return true; }
+  bool fulfilsWeightLimit(Clause* cl) const override { return true; }
+  bool fulfilsWeightLimit(unsigned w, unsigned numPositiveLiterals, const Inference& inference) const override { return true; }
+
+  bool childrenPotentiallyFulfilLimits(Clause* cl, unsigned upperBoundNumSelLits) const override { return true; }
+};
+
+}
+
+#endif /* __LearnedPassiveClauseContainer__ */
@@ -112,6 +112,7 @@
 #include "SymElOutput.hpp"
 #include "SaturationAlgorithm.hpp"
 #include "ManCSPassiveClauseContainer.hpp"
+#include "LearnedPassiveClauseContainer.hpp"
 #include "AWPassiveClauseContainer.hpp"
 #include "PredicateSplitPassiveClauseContainer.hpp"
 #include "Discount.hpp"
@@ -224,7 +225,7 @@ std::unique_ptr<PassiveClauseContainer> makeLevel4(bool isOutermost, const Optio
 SaturationAlgorithm::SaturationAlgorithm(Problem& prb, const Options& opt)
   : MainLoop(prb, opt),
     _clauseActivationInProgress(false),
-    _fwSimplifiers(0), _simplifiers(0), _bwSimplifiers(0), _splitter(0),
+    _fwSimplifiers(0), _simplifiers(0), _bwSimplifiers(0), _splitter(0), _deferredGlobalSubsumption(0),
     _consFinder(0), _labelFinder(0), _symEl(0), _answerLiteralManager(0),
     _instantiation(0),
     _generatedClauseCount(0),
@@ -249,12 +250,20 @@ SaturationAlgorithm::SaturationAlgorithm(Problem& prb, const Options& opt)
   {
     _passive = std::make_unique<ManCSPassiveClauseContainer>(true, opt);
   }
+  else if (!opt.clauseSelectionModel().empty())
+  {
+    _passive = std::make_unique<LearnedPassiveClauseContainer>(true, opt);
+  }
   else
   {
     _passive = makeLevel4(true, opt, "");
   }
   _active = new ActiveClauseContainer(opt);
 
+  if (opt.duplicateClauseFilter()) {
+    _variantFilter = new ClauseVariantFilter();
+  }
+
   _active->attach(this);
   _passive->attach(this);
 
@@ -362,6 +371,11 @@ void SaturationAlgorithm::onActiveAdded(Clause* c)
     env.out() << "[SA] active: " << c->toString() << std::endl;
     env.endOutput();             
   }          
+
+  // clauses usually come through passive, but not e.g. set-of-support ones
+  if (_variantFilter) {
+    _variantFilter->insert(c);
+  }
 }
 
 /**
@@ -405,6 +419,13 @@ void SaturationAlgorithm::onPassiveAdded(Clause* c)
   //when a clause is added to the passive container,
   //we know it is not redundant
   onNonRedundantClause(c);
+
+  if (_variantFilter) {
+    _variantFilter->insert(c);
+  }
+  if (_deferredGlobalSubsumption) {
+    _deferredGlobalSubsumption->addDeferred(c);
+  }
 }
 
 /**
@@ -721,6 +742,9 @@ simpl_start:
   {
     LiteralSelector& sosSelector = getSosLiteralSelector();
     sosSelector.select(cl);
+    if (_opt.literalMaximalityAftercheck() && sosSelector.isBGComplete()) {
+      cl->computeSelectedLiteralOrder(*_ordering);
+    }
   }
 
   cl->setStore(Clause::ACTIVE);
@@ -915,6 +939,22 @@ void SaturationAlgorithm::addUnprocessedClause(Clause* cl)
     return;
   }
 
+  if (_variantFilter) {
+    TIME_TRACE("duplicate clause filter");
+
+    ClauseIterator variants = _variantFilter->retrieveVariants(cl);
+    while (variants.hasNext()) {
+      Clause* variant = variants.next();
+      // as in forward subsumption, the kept clause may not depend on more splits
+      if (!variant->splits()->isSubsetOf(cl->splits())) {
+        continue;
+      }
+      env.statistics->duplicateClauses++;
+      onClauseReduction(cl, 0, 0, variant);
+      return;
+    }
+  }
+
   cl->setStore(Clause::UNPROCESSED);
   _unprocessed->add(cl);
 }
@@ -1084,6 +1124,42 @@ void SaturationAlgorithm::backwardSimplify(Clause* cl)
   }
 }
 
+/**
+ * Check (at most @b maxCnt) clauses queued by the deferred global subsumption
+ * and replace the reduced ones as in backward simplification. Queued clauses
+ * which are no longer passive or active are dropped and do not count.
+ */
+void SaturationAlgorithm::doDeferredGlobalSubsumption(unsigned maxCnt)
+{
+  TIME_TRACE("deferred global subsumption");
+
+  Stack<Unit*> prems;
+  ClauseStack premClauses;
+
+  unsigned checked = 0;
+  while (checked < maxCnt && _deferredGlobalSubsumption->hasDeferred()) {
+    Clause* cl = _deferredGlobalSubsumption->popDeferred();
+
+    // the clause may have been simplified away in the meantime
+    if (cl->store() == Clause::PASSIVE || cl->store() == Clause::ACTIVE) {
+      checked++;
+      Clause* replacement = _deferredGlobalSubsumption->perform(cl, prems);
+      if (replacement != cl) {
+        premClauses.reset();
+        Stack<Unit*>::BottomFirstIterator pit(prems);
+        while (pit.hasNext()) {
+          premClauses.push(pit.next()->asClause());
+        }
+
+        addNewClause(replacement);
+        onClauseReduction(cl, &replacement, 1, pvi( ClauseStack::Iterator(premClauses) ), false);
+        removeActiveOrPassiveClause(cl);
+      }
+    }
+    cl->decRefCnt(); // belongs to popDeferred()
+  }
+}
+
 /**
  * Remove either passive or active (or reactivated, which is both)
  * clause @b cl
@@ -1187,6 +1263,9 @@ void SaturationAlgorithm::activate(Clause* cl)
     }
 
     _selector->select(cl);
+    if (_opt.literalMaximalityAftercheck() && _selector->isBGComplete()) {
+      cl->computeSelectedLiteralOrder(*_ordering);
+    }
   }
 
   ASS_EQ(cl->store(), Clause::SELECTED);
@@ -1319,6 +1398,15 @@ void SaturationAlgorithm::doOneAlgorithmStep()
 {
   doUnprocessedLoop();
 
+  if (_deferredGlobalSubsumption && _deferredGlobalSubsumption->hasDeferred()) {
+    // before concluding saturation, everything still queued gets checked
+    doDeferredGlobalSubsumption(_passive->isEmpty() ? UINT_MAX : _opt.globalSubsumptionDeferred());
+    if (_passive->isEmpty()) {
+      // the replacements, if any, are yet to get to passive
+      return;
+    }
+  }
+
   if (_passive->isEmpty()) {
     MainLoopResult::TerminationReason termReason =
 	isComplete() ? Statistics::SATISFIABLE : Statistics::REFUTATION_NOT_FOUND;
@@ -1372,7 +1460,11 @@ MainLoopResult SaturationAlgorithm::runImpl()
 
       Timer::syncClock();
       if (env.timeLimitReached()) {
-        throw TimeLimitExceededException();
+        if (!Timer::s_pauseAtLimit) {
+          throw TimeLimitExceededException();
+        }
+        // a portfolio slice, which may get resumed with a doubled limit
+        Timer::pauseAtLimit(1);
       }
 
       env.statistics->activations = l;
@@ -1635,7 +1727,11 @@ SaturationAlgorithm* SaturationAlgorithm::createFromOptions(Problem& prb, const
     res->addForwardSimplifierToFront(new InnerRewriting());
   }
   if (opt.globalSubsumption()) {
-    res->addForwardSimplifierToFront(new GlobalSubsumption(opt));
+    GlobalSubsumption* gs = new GlobalSubsumption(opt);
+    res->addForwardSimplifierToFront(gs);
+    if (opt.globalSubsumptionDeferred()) {
+      res->_deferredGlobalSubsumption = gs;
+    }
   }
   if (opt.forwardLiteralRewriting()) {
     res->addForwardSimplifierToFront(new ForwardLiteralRewriting());
@@ -27,6 +27,7 @@
 #include "Kernel/MainLoop.hpp"
 #include "Kernel/RCClauseStack.hpp"
 
+#include "Indexing/ClauseVariantIndex.hpp"
 #include "Indexing/IndexManager.hpp"
 
 #include "Inferences/InferenceEngine.hpp"
@@ -139,6 +140,7 @@ protected:
   void addUnprocessedClause(Clause* cl);
   bool forwardSimplify(Clause* c);
   void backwardSimplify(Clause* c);
+  void doDeferredGlobalSubsumption(unsigned maxCnt);
   void addToPassive(Clause* c);
   void activate(Clause* c);
   void removeSelected(Clause*);
@@ -169,7 +171,6 @@ private:
   void handleEmptyClause(Clause* cl);
   Clause* doImmediateSimplification(Clause* cl);
   MainLoopResult saturateImpl();
-  SmartPtr<IndexManager> _imgr;
 
   class TotalSimplificationPerformer;
   class PartialSimplificationPerformer;
@@ -177,6 +178,8 @@ private:
   static SaturationAlgorithm* s_instance;
 protected:
 
+  SmartPtr<IndexManager> _imgr;
+
   int _startTime;
   int _startInstrs;
 
@@ -213,6 +216,9 @@ protected:
 
   Splitter* _splitter;
 
+  /** The global subsumption engine, if it only queues clauses (see --global_subsumption_deferred) */
+  GlobalSubsumption* _deferredGlobalSubsumption;
+
   ConsequenceFinder* _consFinder;
   LabelFinder* _labelFinder;
   SymElOutput* _symEl;
@@ -231,6 +237,12 @@ protected:
    */
   ScopedPtr<LiteralSelector> _sosLiteralSelector;
 
+  /**
+   * Clauses kept in the passive and active containers, to discard their variants
+   * among new clauses before forward simplification (see --duplicate_clause_filter)
+   */
+  ScopedPtr<ClauseVariantFilter> _variantFilter;
+
 
   // counters
 
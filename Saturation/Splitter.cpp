@@ -387,6 +387,7 @@ SATSolver::Status SplittingBranchSelector::processDPConflicts()
   
   SAT2FO& s2f = _parent.satNaming();
   static LiteralStack gndAssignment;
+  static LiteralStack sortedAssignment;
   static LiteralStack unsatCore;
 
   while (true) { // breaks inside
@@ -398,10 +399,24 @@ SATSolver::Status SplittingBranchSelector::processDPConflicts()
       s2f.collectAssignment(*_solver, gndAssignment); 
       // ... moreover, _dp->addLiterals will filter the set anyway
 
+      // congruence closure is monotone: if no literal was added to the last satisfiable assignment,
+      // the current one is satisfiable as well and we don't need to rebuild the closure
+      // (we compare a sorted copy, as the order of gndAssignment influences the cores)
+      sortedAssignment = gndAssignment;
+      std::sort(sortedAssignment.begin(), sortedAssignment.end());
+      if(std::includes(_dpLastSatAssignment.begin(), _dpLastSatAssignment.end(),
+                       sortedAssignment.begin(), sortedAssignment.end())) {
+        RSTAT_CTR_INC("ssat_dp_check_skipped");
+        break;
+      }
+
       _dp->reset();
       _dp->addLiterals(pvi( LiteralStack::ConstIterator(gndAssignment) ));
       DecisionProcedure::Status dpStatus = _dp->getStatus(_ccMultipleCores);
 
+      if(dpStatus==DecisionProcedure::SATISFIABLE) {
+        std::swap(_dpLastSatAssignment, sortedAssignment);
+      }
       if(dpStatus!=DecisionProcedure::UNSATISFIABLE) {
         break;
       }
@@ -103,6 +103,11 @@ private:
   ScopedPtr<DecisionProcedure> _dp;
   // use a separate copy of the decision procedure for ccModel computations and fill it up only with equalities
   ScopedPtr<SimpleCongruenceClosure> _dpModel;
+  /**
+   * The last ground assignment _dp found satisfiable, sorted by pointer.
+   * Any subset of it is satisfiable too, so such assignments need not be checked again.
+   */
+  LiteralStack _dpLastSatAssignment;
   
   /**
    * Contains selected component names (splitlevels)
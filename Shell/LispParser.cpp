@@ -150,10 +150,69 @@ void LispParser::parse(List** expr0)
   parsing_level_done:
     ASS(stack.isNonEmpty());
     expr = stack.pop();
+    if (stack.isEmpty()) {
+      // only happens when called from parseNext(), on the parenthesis closing a top-level expression
+      return;
+    }
   }
 
 } // parse()
 
+/**
+ * Parse the next top-level expression of the input and return it,
+ * or return nullptr if the end of the input has been reached.
+ *
+ * Unlike parse(), this allows processing the input one top-level
+ * expression at a time, so that each expression can be destroyed
+ * before the next one is read.
+ */
+LispParser::Expression* LispParser::parseNext()
+{
+  ASS_EQ(_balance, 0);
+
+  Token t;
+  _lexer.readToken(t);
+  switch (t.tag) {
+  case TT_RPAR:
+    throw Exception("unmatched right parenthesis",t);
+  case TT_LPAR:
+    {
+      _balance++;
+      Expression* result = new Expression(LIST);
+      parse(&result->list);
+      return result;
+    }
+  case TT_NAME:
+  case TT_INTEGER:
+  case TT_REAL:
+    return new Expression(ATOM,t.text);
+  case TT_EOF:
+    return nullptr;
+  default:
+    ASSERTION_VIOLATION;
+  }
+} // parseNext()
+
+/**
+ * Delete @c expr together with all its subexpressions.
+ */
+void LispParser::Expression::destroy(Expression* expr)
+{
+  Stack<Expression*> todo;
+  todo.push(expr);
+  while (todo.isNonEmpty()) {
+    Expression* e = todo.pop();
+    List* l = e->list;
+    while (l) {
+      todo.push(l->head());
+      List* tail = l->tail();
+      delete l;
+      l = tail;
+    }
+    delete e;
+  }
+} // LispParser::Expression::destroy
+
 /**
  * Return a LISP string corresponding to this expression
  * @since 26/08/2009 Redmond
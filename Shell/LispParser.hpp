@@ -79,6 +79,8 @@ public:
     bool get1Arg(vstring functionName, Expression*& arg);
     bool getPair(Expression*& el1, Expression*& el2);
     bool getSingleton(Expression*& el);
+
+    static void destroy(Expression* expr);
   };
 
   typedef Lib::List<Expression*> List;
@@ -86,6 +88,7 @@ public:
   explicit LispParser(LispLexer& lexer);
   Expression* parse();
   void parse(List**);
+  Expression* parseNext();
 
   /**
    * Class Exception. Implements parser exceptions.
@@ -122,6 +122,11 @@ void NewCNF::clausify(FormulaUnit* unit,Stack<Clause*>& output)
     }
   }
 
+  // bindings never outlive the unit they were created for:
+  // release them now rather than accumulating them over the whole problem
+  _bindingStore.reset();
+  _foolBindingStore.reset();
+
   ASS(_queue.isEmpty());
   ASS(_occurrences.isEmpty());
 }
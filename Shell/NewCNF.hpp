@@ -95,12 +95,17 @@ private:
       _stored.push(lst);
     }
     void pushAndRememberWhileApplying(Binding b, BindingList* &lst);
-    ~BindingStore() {
+    // destroy all the stored cells; only safe once no binding list is in use any more
+    void reset() {
       Stack<BindingList*>::Iterator it(_stored);
       while(it.hasNext()) {
         BindingList* cell = it.next();
         delete cell;
       }
+      _stored.reset();
+    }
+    ~BindingStore() {
+      reset();
     }
   private:
     Stack<BindingList*> _stored;
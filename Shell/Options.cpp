@@ -196,6 +196,20 @@ void Options::init()
     _lookup.insert(&_randomizSeedForPortfolioWorkers);
     _randomizSeedForPortfolioWorkers.onlyUsefulWith(UsingPortfolioTechnology());
 
+    _portfolioSharedPreprocessing = BoolOptionValue("portfolio_shared_preprocessing","",false);
+    _portfolioSharedPreprocessing.description = "In portfolio mode, let consecutive slices of the schedule which agree on all the options "
+      "relevant for preprocessing be run by one process, which preprocesses the problem once and forks the slices from there. "
+      "These slices then run one after another.";
+    _lookup.insert(&_portfolioSharedPreprocessing);
+    _portfolioSharedPreprocessing.onlyUsefulWith(UsingPortfolioTechnology());
+
+    _portfolioPausedSlices = UnsignedOptionValue("portfolio_paused_slices","",0);
+    _portfolioPausedSlices.description = "In portfolio mode, pause a slice that reaches its time (or instruction) limit instead of terminating it, "
+      "keeping up to this many paused slices around. When the schedule is run again with doubled limits, paused slices are resumed "
+      "(with their limit doubled) instead of being started from scratch. 0 means that slices are never paused.";
+    _lookup.insert(&_portfolioPausedSlices);
+    _portfolioPausedSlices.onlyUsefulWith(UsingPortfolioTechnology());
+
     _ltbLearning = ChoiceOptionValue<LTBLearning>("ltb_learning","ltbl",LTBLearning::OFF,{"on","off","biased"});
     _ltbLearning.description = "Perform learning in LTB mode";
     _lookup.insert(&_ltbLearning);
@@ -368,6 +382,12 @@ void Options::init()
     _timeStatistics.description="Show how much running time was spent in each part of Vampire";
     _lookup.insert(&_timeStatistics);
     _timeStatistics.tag(OptionTag::OUTPUT);
+
+    _timeStatisticsInstructions = BoolOptionValue("time_statistics_instructions","tstati",false);
+    _timeStatisticsInstructions.description="Also show how many (user) instructions were spent in each part of Vampire. Needs the instruction counter of perf_event to be available.";
+    _lookup.insert(&_timeStatisticsInstructions);
+    _timeStatisticsInstructions.onlyUsefulWith(_timeStatistics.is(equal(true)));
+    _timeStatisticsInstructions.tag(OptionTag::OUTPUT);
 #endif // VTIME_PROFILING
 
 //*********************** Input  ***********************
@@ -940,6 +960,14 @@ void Options::init()
     _ageWeightRatio.onlyUsefulWith2(ProperSaturationAlgorithm());
     _ageWeightRatio.setRandomChoices({"8:1","5:1","4:1","3:1","2:1","3:2","5:4","1","2:3","2","3","4","5","6","7","8","10","12","14","16","20","24","28","32","40","50","64","128","1024"});
 
+    _clauseSelectionModel = StringOptionValue("clause_selection_model","","");
+    _clauseSelectionModel.description="Select clauses by alternating, in the age:weight ratio, between the oldest clause and the clause "
+      "best scored by the linear or one-hidden-layer model in the given file (see Saturation/LearnedPassiveClauseContainer.hpp for the format). "
+      "Limited resource strategy limits are not applied with such a model.";
+    _lookup.insert(&_clauseSelectionModel);
+    _clauseSelectionModel.tag(OptionTag::SATURATION);
+    _clauseSelectionModel.onlyUsefulWith(ProperSaturationAlgorithm());
+
     _ageWeightRatioShape = ChoiceOptionValue<AgeWeightRatioShape>("age_weight_ratio_shape","awrs",AgeWeightRatioShape::CONSTANT,{"constant","decay", "converge"});
     _ageWeightRatioShape.description = "How to change the age/weight ratio during proof search.";
     _ageWeightRatioShape.onlyUsefulWith(_ageWeightRatio.is(isNotDefaultRatio()));
@@ -1141,6 +1169,14 @@ void Options::init()
     _lrsEstimateCorrectionCoef.addConstraint(greaterThan(0.0f));
     _lrsEstimateCorrectionCoef.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::LRS)));
     _lrsEstimateCorrectionCoef.setRandomChoices({"1.0","1.1","1.2","0.9","0.8"});    
+
+    _lrsInstructionRate = UnsignedOptionValue("lrs_instruction_rate","lrsir",0);
+    _lrsInstructionRate.description = "If non-zero and instructions can be counted, lrs estimates how many clauses are still reachable "
+      "only from executed instructions (not elapsed time), turning the time limit into a budget of this many mega-instructions per second. "
+      "This makes the limits independent of the machine load.";
+    _lookup.insert(&_lrsInstructionRate);
+    _lrsInstructionRate.tag(OptionTag::SATURATION);
+    _lrsInstructionRate.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::LRS)));
     
   //*********************** Inferences  ***********************
 
@@ -1381,6 +1417,14 @@ void Options::init()
     _inductionStrengthenHypothesis.onlyUsefulWith(_induction.is(notEqual(Induction::NONE)));
     _lookup.insert(&_inductionStrengthenHypothesis);
 
+    _inductionClausificationCache = BoolOptionValue("induction_clausification_cache","indcc",false);
+    _inductionClausificationCache.description = "Clausify induction formulas that only differ in their ground subterms"
+                                                " (e.g. Skolem constants) once, and instantiate the cached clauses"
+                                                " with the other terms and fresh Skolem symbols";
+    _inductionClausificationCache.tag(OptionTag::INFERENCES);
+    _inductionClausificationCache.onlyUsefulWith(_induction.is(notEqual(Induction::NONE)));
+    _lookup.insert(&_inductionClausificationCache);
+
     _inductionOnComplexTerms = BoolOptionValue("induction_on_complex_terms","indoct",false);
     _inductionOnComplexTerms.description = "Apply induction on complex (ground) terms vs. only on constants";
     _inductionOnComplexTerms.tag(OptionTag::INFERENCES);
@@ -1674,6 +1718,13 @@ void Options::init()
     _forwardSubsumption.tag(OptionTag::INFERENCES);
     _forwardSubsumption.setRandomChoices({"on","on","on","on","on","on","on","on","on","off"}); // turn this off rarely
 
+    _duplicateClauseFilter = BoolOptionValue("duplicate_clause_filter","dcf",false);
+    _duplicateClauseFilter.description="Discard new clauses which are variants of passive or active clauses right after immediate simplification, "
+      "before any (more expensive) forward simplification. Variants are looked up by a renaming-invariant hash guarded by a Bloom filter.";
+    _lookup.insert(&_duplicateClauseFilter);
+    _duplicateClauseFilter.tag(OptionTag::INFERENCES);
+    _duplicateClauseFilter.onlyUsefulWith(ProperSaturationAlgorithm());
+
     _forwardSubsumptionResolution = BoolOptionValue("forward_subsumption_resolution","fsr",true);
     _forwardSubsumptionResolution.description="Perform forward subsumption resolution.";
     _lookup.insert(&_forwardSubsumptionResolution);
@@ -1950,6 +2001,14 @@ void Options::init()
     _globalSubsumptionAvatarAssumptions.onlyUsefulWith(_splitting.is(equal(true)));
     _globalSubsumptionAvatarAssumptions.setRandomChoices({"off","from_current","full_model"});
 
+    _globalSubsumptionDeferred = UnsignedOptionValue("global_subsumption_deferred","gsd",0);
+    _globalSubsumptionDeferred.description="If non-zero, global subsumption does not hold up the forward simplification of new clauses. "
+      "Instead, clauses are queued once added to passive and at most this many of them are checked in every iteration of the main loop. "
+      "A clause reduced by then is replaced in the passive or active container like in backward simplification.";
+    _lookup.insert(&_globalSubsumptionDeferred);
+    _globalSubsumptionDeferred.tag(OptionTag::INFERENCES);
+    _globalSubsumptionDeferred.onlyUsefulWith(_globalSubsumption.is(equal(true)));
+
     _useHashingVariantIndex = BoolOptionValue("use_hashing_clause_variant_index","uhcvi",false);
     _useHashingVariantIndex.description= "Use clause variant index based on hashing for clause variant detection (affects avatar).";
     _lookup.insert(&_useHashingVariantIndex);
@@ -3316,6 +3375,48 @@ vstring Options::generateEncodedOptions() const
 }
 
 
+/**
+ * Return a string determined by the values of the options which can influence
+ * preprocessing, so that two strategies with the same fingerprint produce the
+ * same preprocessed problem (given the same input).
+ *
+ * These are the options tagged as preprocessing, input or higher-order ones, and
+ * the other options read during preprocessing. When adding an option of another
+ * kind that preprocessing reads, add it here as well.
+ */
+vstring Options::preprocessingFingerprint() const
+{
+  Set<const AbstractOptionValue*> alsoRelevant;
+  alsoRelevant.insert(&_randomSeed);
+  alsoRelevant.insert(&_saturationAlgorithm);
+  alsoRelevant.insert(&_questionAnswering);
+  alsoRelevant.insert(&_FOOLParamodulation);
+  alsoRelevant.insert(&_induction);
+  alsoRelevant.insert(&_termAlgebraCyclicityCheck);
+  alsoRelevant.insert(&_increasedNumeralWeight);
+  alsoRelevant.insert(&_nonGoalWeightCoefficient);
+  alsoRelevant.insert(&_restrictNWCtoGC);
+  alsoRelevant.insert(&_nonliteralsInClauseWeight);
+  alsoRelevant.insert(&_symbolPrecedence);
+  alsoRelevant.insert(&_sineToAge);
+  alsoRelevant.insert(&_sineToAgeGeneralityThreshold);
+  alsoRelevant.insert(&_sineToAgeTolerance);
+  alsoRelevant.insert(&_sineToPredLevels);
+  alsoRelevant.insert(&_useSineLevelSplitQueues);
+  alsoRelevant.insert(&_theorySplitQueueExpectedRatioDenom);
+
+  vostringstream res;
+  VirtualIterator<AbstractOptionValue*> options = _lookup.values();
+  while(options.hasNext()){
+    AbstractOptionValue* option = options.next();
+    OptionTag tag = option->getTag();
+    if(tag==OptionTag::PREPROCESSING || tag==OptionTag::INPUT || tag==OptionTag::HIGHER_ORDER || alsoRelevant.contains(option)) {
+      res << option->longName << "=" << option->getStringOfActual() << ":";
+    }
+  }
+  return res.str();
+}
+
 /**
  * True if the options are complete.
  * @since 23/07/2011 Manchester
@@ -460,6 +460,9 @@ void Preprocess::preprocess(Problem& prb)
      UIHelper::outputAllPremises(cerr, prb.units());
    }
 
+   // preprocessing churns through lots of short-lived formulas: make their memory available again
+   Lib::releaseFreeMemory();
+
    if (env.options->showPreprocessing()) {
      env.out() << "preprocessing finished" << std::endl;
      env.endOutput();
@@ -268,6 +268,38 @@ void SineBase::initGeneralityFunction(UnitList* units)
   }
 }
 
+/**
+ * Extract the symbols of each unit in @b units once, storing them in the symbol table
+ * (see @b storedSymIds()), and compute the generality function along the way.
+ *
+ * Units get consecutive indices in the order of @b units.
+ */
+void SineBase::initSymbolTable(UnitList* units)
+{
+  SymId symIdBound=_symExtr.getSymIdBound();
+  _gen.init(symIdBound,0);
+
+  _symIds.reset();
+  _symIdOffsets.reset();
+  _unitIndices.reset();
+
+  unsigned index=0;
+  UnitList::Iterator uit(units);
+  while (uit.hasNext()) {
+    Unit* u=uit.next();
+    _unitIndices.insert(u,index++);
+    _symIdOffsets.push(_symIds.size());
+
+    SymIdIterator sit=_symExtr.extractSymIds(u);
+    while (sit.hasNext()) {
+      SymId sid=sit.next();
+      _gen[sid]++;
+      _symIds.push(sid);
+    }
+  }
+  _symIdOffsets.push(_symIds.size());
+}
+
 SineSelector::SineSelector(const Options& opt)
 : _onIncluded(opt.sineSelection()==Options::SineSelection::INCLUDED),
   _genThreshold(opt.sineGeneralityThreshold()),
@@ -296,11 +328,11 @@ void SineSelector::init()
 }
 
 /**
- * Connect unit @b u with symbols it defines
+ * Connect unit @b u, which has index @b unitIndex in the symbol table, with symbols it defines
  */
-void SineSelector::updateDefRelation(Unit* u)
+void SineSelector::updateDefRelation(Unit* u, unsigned unitIndex)
 {
-  SymIdIterator sit=_symExtr.extractSymIds(u);
+  StoredSymIdIterator sit=storedSymIds(unitIndex);
 
   if (!sit.hasNext()) {
     if(_justForSineLevels){
@@ -359,7 +391,7 @@ void SineSelector::updateDefRelation(Unit* u)
 
     //if the generalityLimit is under _genThreshold, all suitable symbols are already added
     if (generalityLimit>_genThreshold) {
-      sit=_symExtr.extractSymIds(u);
+      sit=storedSymIds(unitIndex);
       while (sit.hasNext()) {
 	SymId sym=sit.next();
 	unsigned val=_gen[sym];
@@ -385,7 +417,8 @@ bool SineSelector::perform(UnitList*& units)
 {
   TIME_TRACE(TimeTrace::SINE_SELECTION);
 
-  initGeneralityFunction(units);
+  // symbols of each unit are extracted only once and reused below
+  initSymbolTable(units);
 
   SymId symIdBound=_symExtr.getSymIdBound();
 
@@ -398,12 +431,12 @@ bool SineSelector::perform(UnitList*& units)
   unsigned numberUnitsLeftOut = 0;
   UnitList::Iterator uit2(units);
   while (uit2.hasNext()) {
-    numberUnitsLeftOut++;
+    unsigned unitIndex=numberUnitsLeftOut++;
     Unit* u=uit2.next();
     bool performSelection= _onIncluded ? u->included() : ((u->inputType()==UnitInputType::AXIOM)
                             || (env.options->guessTheGoal() != Options::GoalGuess::OFF && u->inputType()==UnitInputType::ASSUMPTION));
     if (performSelection) { // register the unit for later
-      updateDefRelation(u);
+      updateDefRelation(u,unitIndex);
     }
     else { // goal units are immediately taken (well, non-axiom, to by more precise. Includes ASSUMPTION, which cl->isGoal() does not take into account)
       selected.insert(u);
@@ -448,7 +481,7 @@ bool SineSelector::perform(UnitList*& units)
       continue;
     }
 
-    SymIdIterator sit=_symExtr.extractSymIds(u);
+    StoredSymIdIterator sit=storedSymIds(_unitIndices.get(u));
     while (sit.hasNext()) {
       SymId sym=sit.next();
 
@@ -18,6 +18,8 @@
 #include "Forwards.hpp"
 
 #include "Lib/DArray.hpp"
+#include "Lib/DHMap.hpp"
+#include "Lib/Metaiterators.hpp"
 #include "Lib/Stack.hpp"
 
 namespace Shell {
@@ -50,11 +52,29 @@ protected:
   typedef SineSymbolExtractor::SymId SymId;
   typedef SineSymbolExtractor::SymIdIterator SymIdIterator;
 
+  typedef PointerIterator<SymId> StoredSymIdIterator;
+
   void initGeneralityFunction(UnitList* units);
+  void initSymbolTable(UnitList* units);
+
+  /** Symbols of the unit with index @b unitIndex in the symbol table, in the order of @b extractSymIds() */
+  StoredSymIdIterator storedSymIds(unsigned unitIndex)
+  {
+    return StoredSymIdIterator(_symIds.begin()+_symIdOffsets[unitIndex], _symIds.begin()+_symIdOffsets[unitIndex+1]);
+  }
 
   /** Stores symbol generality */
   DArray<unsigned> _gen;
 
+  /**
+   * Symbols of each unit, extracted once by @b initSymbolTable() and stored contiguously:
+   * the symbols of the unit with index i are _symIds[_symIdOffsets[i]] up to _symIds[_symIdOffsets[i+1]]
+   */
+  Stack<SymId> _symIds;
+  Stack<unsigned> _symIdOffsets;
+  /** Index of each unit in the symbol table */
+  DHMap<Unit*,unsigned> _unitIndices;
+
   SineSymbolExtractor _symExtr;
 };
 
@@ -81,7 +101,7 @@ public:
 private:
   void init();
 
-  void updateDefRelation(Unit* u);
+  void updateDefRelation(Unit* u, unsigned unitIndex);
 
   bool _onIncluded;
   bool _strict;
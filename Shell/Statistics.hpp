@@ -226,6 +226,8 @@ public:
   unsigned forwardSubsumed;
   /** number of backward subsumed clauses */
   unsigned backwardSubsumed;
+  /** number of new clauses discarded as variants of kept ones, each saving a forward subsumption check */
+  unsigned duplicateClauses;
 
   /** statistics of term algebra rules */
   unsigned taDistinctnessSimplifications;
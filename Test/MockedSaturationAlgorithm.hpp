@@ -14,6 +14,7 @@
 #include "Saturation/Otter.hpp"
 #include "Kernel/Clause.hpp"
 #include "Kernel/KBO.hpp"
+#include "Indexing/IndexManager.hpp"
 
 namespace Test {
 
@@ -21,6 +22,8 @@ class MockedSaturationAlgorithm : public Saturation::Otter {
 public:
   MockedSaturationAlgorithm(Kernel::Problem& p, Shell::Options& o) : Otter(p,o) 
   {
+    // so that inference engines can request their indices in attach
+    _imgr = Lib::SmartPtr<Indexing::IndexManager>(new Indexing::IndexManager(this));
   }
 };
 
@@ -12,6 +12,8 @@
  * Implements class RuntimeStatistics.
  */
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <fstream>
 
@@ -21,6 +23,7 @@
 #include "Lib/Int.hpp"
 #include "Lib/Sort.hpp"
 #include "Lib/Stack.hpp"
+#include "Lib/Timer.hpp"
 
 #include "UnitTesting.hpp"
 
@@ -193,6 +196,78 @@ bool UnitTesting::add(vstring const& testUnit, TestUnit::Test test)
 std::ostream& operator<<(ostream& out, TestUnit::Test const& t) 
 { return out << t.name; }
 
+static unsigned readEnvUnsigned(const char* var, unsigned dflt)
+{
+  const char* val = getenv(var);
+  unsigned out;
+  if (val && Int::stringToUnsignedInt(val, out) && out > 0) {
+    return out;
+  }
+  return dflt;
+}
+
+Benchmark::Benchmark(vstring name)
+  : _name(std::move(name))
+  , _repetitions(readEnvUnsigned("VBENCH_REPETITIONS", 5))
+  , _minBatchTime(std::chrono::milliseconds(readEnvUnsigned("VBENCH_MIN_BATCH_MS", 10)))
+{
+  if (!Timer::instructionLimitingInPlace()) {
+    // (try to) open the instruction counter
+    Timer::resetInstructionMeasuring();
+  }
+}
+
+void Benchmark::startBatch()
+{
+  _batchStartInstrs = Timer::elapsedInstructions();
+  _batchStart = Clock::now();
+}
+
+Benchmark::Clock::duration Benchmark::endBatch(unsigned iterations, bool record)
+{
+  auto duration = Clock::now() - _batchStart;
+  auto instrs = Timer::elapsedInstructions();
+  if (record) {
+    _nanos.push(double(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) / iterations);
+    if (_batchStartInstrs >= 0 && instrs >= 0) {
+      _instrs.push(double(instrs - _batchStartInstrs) / iterations);
+    }
+  }
+  return duration;
+}
+
+static double median(Stack<double>& xs)
+{
+  ASS(xs.isNonEmpty())
+  std::sort(xs.begin(), xs.end());
+  auto n = xs.size();
+  return n % 2 == 1 ? xs[n / 2] : (xs[n / 2 - 1] + xs[n / 2]) / 2;
+}
+
+void Benchmark::report(std::ostream& out, unsigned iterations)
+{
+  double sum = 0;
+  for (auto x : _nanos) { sum += x; }
+  double mean = sum / _nanos.size();
+  double sqDev = 0;
+  for (auto x : _nanos) { sqDev += (x - mean) * (x - mean); }
+  double stddev = std::sqrt(sqDev / _nanos.size());
+  // median sorts the samples, so it has to come before reading the minimum
+  double medianNanos = median(_nanos);
+  double minNanos = _nanos[0];
+
+  out << endl << _name << ": " << fixed << setprecision(1) 
+      << medianNanos << " ns/iter"
+      << " (min: " << minNanos
+      << ", mean: " << mean
+      << ", sd: " << stddev
+      << "; " << _repetitions << " x " << iterations << " iters)";
+  if (_instrs.isNonEmpty()) {
+    out << ", " << median(_instrs) << " instrs/iter";
+  }
+  out << endl;
+}
+
 } // namespace Test
 
 int main(int argc, const char** argv) 
@@ -17,6 +17,7 @@
 
 #include <string.h>
 #include <ostream>
+#include <chrono>
 
 
 #include "Forwards.hpp"
@@ -99,6 +100,70 @@ public:
   TestAdder(const char* unit, TestProc proc, const char* name);
 };
 
+/**
+ * Measures how long a piece of code takes, to be used in BENCH_FUN.
+ *
+ * The code is first run in batches of doubling size until a batch takes at least
+ * a minimal time, which serves as warm-up. Then this batch is repeated several times,
+ * and the time and number of (user) instructions per iteration are summarized.
+ * Repetitions and minimal batch time can be set by the environment variables
+ * VBENCH_REPETITIONS (default 5) and VBENCH_MIN_BATCH_MS (default 10).
+ */
+class Benchmark
+{
+  using Clock = std::chrono::steady_clock;
+
+  vstring _name;
+  unsigned _repetitions;
+  Clock::duration _minBatchTime;
+
+  Clock::time_point _batchStart;
+  long long _batchStartInstrs;
+
+  void startBatch();
+  /** returns how long the batch took and records it if @b record is set */
+  Clock::duration endBatch(unsigned iterations, bool record);
+  void report(std::ostream& out, unsigned iterations);
+
+  Stack<double> _nanos;
+  Stack<double> _instrs;
+public:
+  Benchmark(vstring name);
+
+  template<class Fn> 
+  void measure(Fn fn)
+  {
+    _nanos.reset();
+    _instrs.reset();
+
+    unsigned iterations = 1;
+    for (;;) {
+      startBatch();
+      for (unsigned i = 0; i < iterations; i++) {
+        fn();
+      }
+      if (endBatch(iterations, false) >= _minBatchTime || iterations >= (1u << 30)) {
+        break;
+      }
+      iterations *= 2;
+    }
+
+    for (unsigned r = 0; r < _repetitions; r++) {
+      startBatch();
+      for (unsigned i = 0; i < iterations; i++) {
+        fn();
+      }
+      endBatch(iterations, true);
+    }
+    report(std::cout, iterations);
+  }
+};
+
+/** prevents the compiler from optimizing away the computation of @b value in a benchmark */
+template<class T>
+inline void doNotOptimize(T const& value)
+{ asm volatile("" : : "r,m"(value) : "memory"); }
+
 #define EXPAND(a) a
 #define _CAT(a,b) a ## b
 #define CAT(a,b) EXPAND(_CAT(a,b)) // expands arguments before concattentation
@@ -110,6 +175,21 @@ public:
     Test::TestAdder __TEST_ADDER(name)(UNIT_ID_STR, __TEST_FN_NAME(name), #name);                             \
     void __TEST_FN_NAME(name)()
 
+#define __BENCH_RUNNER_NAME(name) CAT(CAT(CAT(__benchRunner__ , UNIT_ID), __), name)
+
+/**
+ * Defines a benchmark. It is run like a test case of its unit (i.e. `vtest run <unit> [<name>]`),
+ * and the body has access to a Test::Benchmark called @b bench, whose method measure(fn) times
+ * fn and prints the summary. Setting up the data to be worked on should happen before calling
+ * measure, in order not to be measured.
+ */
+#define BENCH_FUN(name)                                                                                       \
+    void __TEST_FN_NAME(name)(Test::Benchmark& bench);                                                        \
+    void __BENCH_RUNNER_NAME(name)()                                                                          \
+    { Test::Benchmark bench(UNIT_ID_STR "/" #name); __TEST_FN_NAME(name)(bench); }                            \
+    Test::TestAdder __TEST_ADDER(name)(UNIT_ID_STR, __BENCH_RUNNER_NAME(name), #name);                        \
+    void __TEST_FN_NAME(name)(Test::Benchmark& bench)
+
 } // namespace Test
 
 int main(int argc, const char** argv);
@@ -0,0 +1,67 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Indexing/ClauseCodeTree.hpp"
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Kernel;
+using namespace Indexing;
+using namespace Test;
+
+/**
+ * Index the clauses p(g^i(a), x) \/ q(x, g^j(b)) (and some variants) for i, j < 10,
+ * and count how many of them subsume (or subsumption-resolve, if @b sres) a fixed query.
+ * Most of the time is spent in CodeTree::Matcher::execute().
+ */
+void benchSubsumption(Benchmark& bench, bool sres)
+{
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_FUNC(g, {srt}, srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+  DECL_CONST(c, srt)
+  DECL_PRED(p, {srt, srt})
+  DECL_PRED(q, {srt, srt})
+  DECL_PRED(r, {srt})
+
+  ClauseCodeTree tree;
+  TermSugar gi = a;
+  for (unsigned i = 0; i < 10; i++) {
+    TermSugar gj = b;
+    for (unsigned j = 0; j < 10; j++) {
+      tree.insert(clause({ p(gi, x), q(x, gj) }));
+      tree.insert(clause({ p(gi, x), ~q(x, gj) }));
+      tree.insert(clause({ p(x, gj), q(y, gi), r(y) }));
+      gj = g(gj);
+    }
+    gi = g(gi);
+  }
+
+  auto query = clause({ p(g(g(g(a))), g(b)), q(g(b), g(g(g(g(g(b)))))), r(c), ~r(g(c)) });
+  bench.measure([&]() {
+    unsigned cnt = 0;
+    ClauseCodeTree::ClauseMatcher cm;
+    cm.init(&tree, query, sres);
+    int resolvedQueryLit;
+    while (cm.next(resolvedQueryLit)) {
+      cnt++;
+    }
+    cm.reset();
+    doNotOptimize(cnt);
+  });
+}
+
+BENCH_FUN(subsumption)
+{ benchSubsumption(bench, /* sres */ false); }
+
+BENCH_FUN(subsumption_resolution)
+{ benchSubsumption(bench, /* sres */ true); }
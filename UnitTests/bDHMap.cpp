@@ -0,0 +1,49 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Lib/DHMap.hpp"
+#include "Test/UnitTesting.hpp"
+
+using namespace Lib;
+using namespace Test;
+
+typedef DHMap<unsigned, unsigned> MyMap;
+
+// spread out keys, as the ones we usually store (e.g. pointers and term ids) are not dense either
+static unsigned key(unsigned i)
+{ return i * 2654435761u; }
+
+BENCH_FUN(insert_1000)
+{
+  bench.measure([]() {
+    MyMap m;
+    for (unsigned i = 0; i < 1000; i++) {
+      m.insert(key(i), i);
+    }
+    doNotOptimize(m.size());
+  });
+}
+
+BENCH_FUN(find_1000)
+{
+  MyMap m;
+  for (unsigned i = 0; i < 1000; i++) {
+    m.insert(key(i), i);
+  }
+
+  bench.measure([&]() {
+    unsigned found = 0;
+    // half of the lookups are misses
+    for (unsigned i = 0; i < 2000; i += 2) {
+      found += m.find(key(i));
+    }
+    doNotOptimize(found);
+  });
+}
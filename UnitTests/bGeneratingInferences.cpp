@@ -0,0 +1,92 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Kernel/Problem.hpp"
+#include "Indexing/LiteralIndex.hpp"
+#include "Indexing/TermIndex.hpp"
+#include "Saturation/ClauseContainer.hpp"
+#include "Shell/Options.hpp"
+
+#include "Inferences/BinaryResolution.hpp"
+#include "Inferences/EqualityFactoring.hpp"
+#include "Inferences/Superposition.hpp"
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+#include "Test/MockedSaturationAlgorithm.hpp"
+
+using namespace Kernel;
+using namespace Inferences;
+using namespace Test;
+
+/**
+ * Generate the inferences of a fixed given clause with a fixed active set of
+ * equations f(g^i(a), x) = g(x) and clauses ~p(f(g^i(a), x)) | q(x) for i < 10.
+ * The number of inferences per iteration is printed, so that the time per
+ * iteration can be turned into inferences per second.
+ */
+template<class Rule>
+void benchGeneration(Benchmark& bench)
+{
+  DECL_DEFAULT_VARS
+  DECL_SORT(s)
+  DECL_FUNC(f, {s, s}, s)
+  DECL_FUNC(g, {s}, s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_PRED(p, {s})
+  DECL_PRED(q, {s})
+
+  ClauseStack active;
+  TermSugar gi = a;
+  for (unsigned i = 0; i < 10; i++) {
+    active.push(clause({ selected(f(gi, x) == g(x)) }));
+    active.push(clause({ selected(~p(f(gi, x))), q(x) }));
+    gi = g(gi);
+  }
+  Clause* given = clause({ selected(p(f(y, g(g(b))))), selected(f(y, b) == g(g(y))), selected(f(a, z) == g(z)) });
+  active.push(given);
+
+  // the ordering is chosen for the problem, so it has to contain the clauses
+  Problem prb(pvi(ClauseStack::Iterator(active)), /* copy */ false);
+  Options opt;
+  env.setMainProblem(&prb);
+  MockedSaturationAlgorithm alg(prb, opt);
+  Rule rule;
+  rule.attach(&alg);
+
+  for (Clause* cl : active) {
+    cl->setStore(Clause::ACTIVE);
+    alg.getGeneratingClauseContainer()->add(cl);
+  }
+
+  auto generate = [&]() {
+    unsigned cnt = 0;
+    auto it = rule.generateClauses(given);
+    while (it.hasNext()) {
+      it.next()->destroyIfUnnecessary();
+      cnt++;
+    }
+    return cnt;
+  };
+  std::cout << "inferences per iteration: " << generate() << std::endl;
+  bench.measure([&]() { doNotOptimize(generate()); });
+
+  rule.detach();
+}
+
+BENCH_FUN(superposition)
+{ benchGeneration<Superposition>(bench); }
+
+BENCH_FUN(binary_resolution)
+{ benchGeneration<BinaryResolution>(bench); }
+
+BENCH_FUN(equality_factoring)
+{ benchGeneration<EqualityFactoring>(bench); }
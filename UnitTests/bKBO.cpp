@@ -0,0 +1,83 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Kernel/KBO.hpp"
+#include "Kernel/Ordering.hpp"
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+#include "tKBO.hpp"
+
+using namespace Kernel;
+using namespace Test;
+
+/** KBO with all weights 1 and the precedence given by the declaration order */
+static KBO defaultKbo() 
+{
+  return KBO(toWeightMap<FuncSigTraits>(1, { 
+          ._variableWeight = 1,
+          ._numInt  = 1,
+          ._numRat  = 1,
+          ._numReal = 1,
+        }, Map<unsigned, KboWeight>(), env.signature->functions()), 
+#if __KBO__CUSTOM_PREDICATE_WEIGHTS__
+             toWeightMap<PredSigTraits>(1,
+               KboSpecialWeights<PredSigTraits>::dflt(), 
+               Map<unsigned, KboWeight>(),
+               env.signature->predicates()), 
+#endif
+             DArray<int>::fromIterator(getRangeIterator(0, (int) env.signature->functions())),
+             DArray<int>::fromIterator(getRangeIterator(0, (int) env.signature->typeCons())),
+             DArray<int>::fromIterator(getRangeIterator(0, (int) env.signature->predicates())),
+             predLevels(),
+             /*revereseLCM*/ false);
+}
+
+BENCH_FUN(compare_ground)
+{
+  DECL_SORT(srt)
+  DECL_FUNC(f, {srt, srt}, srt)
+  DECL_FUNC(g, {srt}, srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+
+  // same weight, decided lexicographically deep down
+  TermSugar l = a;
+  TermSugar r = a;
+  for (unsigned i = 0; i < 10; i++) {
+    l = f(g(l), a);
+    r = f(g(r), i < 9 ? a : b);
+  }
+  auto ord = defaultKbo();
+  TermList lt = l;
+  TermList rt = r;
+
+  bench.measure([&]() { doNotOptimize(ord.compare(lt, rt)); });
+}
+
+BENCH_FUN(compare_non_ground)
+{
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_FUNC(f, {srt, srt}, srt)
+  DECL_FUNC(g, {srt}, srt)
+
+  // variable occurrences have to be counted to find out these are incomparable
+  TermSugar l = x;
+  TermSugar r = y;
+  for (unsigned i = 0; i < 10; i++) {
+    l = f(g(l), y);
+    r = f(r, g(x));
+  }
+  auto ord = defaultKbo();
+  TermList lt = l;
+  TermList rt = r;
+
+  bench.measure([&]() { doNotOptimize(ord.compare(lt, rt)); });
+}
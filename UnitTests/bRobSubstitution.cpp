@@ -0,0 +1,61 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Kernel/RobSubstitution.hpp"
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Kernel;
+using namespace Test;
+
+/**
+ * Unify f(x0, f(x1, ... f(x9, a))) with f(g(a), f(g(x1), ... f(g(x9), a))), with the sides in
+ * different variable banks, and undo the bindings with @b undo, which is what index retrieval
+ * does for every candidate.
+ */
+template<class Undo>
+void benchUnification(Benchmark& bench, Undo undo)
+{
+  DECL_SORT(srt)
+  DECL_FUNC(f, {srt, srt}, srt)
+  DECL_FUNC(g, {srt}, srt)
+  DECL_CONST(a, srt)
+
+  TermSugar l = a;
+  TermSugar r = a;
+  for (unsigned i = 0; i < 10; i++) {
+    l = f(TermSugar(TermList::var(i)), l);
+    r = f(g(i == 0 ? a : TermSugar(TermList::var(i))), r);
+  }
+  TermList lt = l;
+  TermList rt = r;
+
+  RobSubstitution subst;
+  bench.measure([&]() { undo(subst, [&]() { doNotOptimize(subst.unify(lt, 0, rt, 1)); }); });
+}
+
+BENCH_FUN(unify_reset)
+{
+  benchUnification(bench, [](RobSubstitution& subst, auto unify) {
+    unify();
+    subst.reset();
+  });
+}
+
+BENCH_FUN(unify_backtrack)
+{
+  benchUnification(bench, [](RobSubstitution& subst, auto unify) {
+    BacktrackData bd;
+    subst.bdRecord(bd);
+    unify();
+    subst.bdDone();
+    bd.backtrack();
+  });
+}
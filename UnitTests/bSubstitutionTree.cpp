@@ -0,0 +1,66 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Indexing/TermSubstitutionTree.hpp"
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Kernel;
+using namespace Indexing;
+using namespace Test;
+
+/** 
+ * Index the terms f(g^i(a), g^j(b)) for i, j < 10 (and some variants with variables), 
+ * and count how many of them are retrieved for @b query.
+ */
+template<class Retrieve>
+void benchRetrieval(Benchmark& bench, Retrieve retrieve)
+{
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_FUNC(f, {srt, srt}, srt)
+  DECL_FUNC(g, {srt}, srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+  DECL_PRED(p, {srt})
+
+  TermSubstitutionTree index;
+  TermSugar gi = a;
+  for (unsigned i = 0; i < 10; i++) {
+    TermSugar gj = b;
+    for (unsigned j = 0; j < 10; j++) {
+      for (auto t : { f(gi, gj), f(gi, x), f(x, gj) }) {
+        index.insert(TypedTermList(t.sugaredExpr().term()), p(t), clause({ p(t) }));
+      }
+      gj = g(gj);
+    }
+    gi = g(gi);
+  }
+
+  auto query = TypedTermList(f(g(g(a)), y).sugaredExpr().term());
+  bench.measure([&]() {
+    unsigned cnt = 0;
+    auto it = retrieve(index, query);
+    while (it.hasNext()) {
+      it.next();
+      cnt++;
+    }
+    doNotOptimize(cnt);
+  });
+}
+
+BENCH_FUN(unifications)
+{ benchRetrieval(bench, [](auto& index, auto query) { return index.getUnifications(query, /* retrieveSubstitutions */ true, /* withConstraints */ false); }); }
+
+BENCH_FUN(instances)
+{ benchRetrieval(bench, [](auto& index, auto query) { return index.getInstances(query, /* retrieveSubstitutions */ true); }); }
+
+BENCH_FUN(generalizations)
+{ benchRetrieval(bench, [](auto& index, auto query) { return index.getGeneralizations(query, /* retrieveSubstitutions */ true); }); }
@@ -0,0 +1,118 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Lib/DHMap.hpp"
+#include "Lib/SwissMap.hpp"
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Lib;
+using namespace Test;
+
+/*
+ * The same insertions and lookups of 1000 keys (half of the lookups being misses)
+ * as DHMap and as SwissMap, over the kinds of keys we mostly store: numbers,
+ * and pointers to shared terms and literals.
+ */
+
+template<class Map, class Key>
+void benchInsert(Benchmark& bench, Stack<Key> const& keys)
+{
+  bench.measure([&]() {
+    Map m;
+    for (unsigned i = 0; i < keys.size(); i += 2) {
+      m.insert(keys[i], i);
+    }
+    doNotOptimize(m.size());
+  });
+}
+
+template<class Map, class Key>
+void benchFind(Benchmark& bench, Stack<Key> const& keys)
+{
+  Map m;
+  for (unsigned i = 0; i < keys.size(); i += 2) {
+    m.insert(keys[i], i);
+  }
+  bench.measure([&]() {
+    unsigned found = 0;
+    for (unsigned i = 0; i < keys.size(); i++) {
+      found += m.find(keys[i]);
+    }
+    doNotOptimize(found);
+  });
+}
+
+static Stack<unsigned> unsignedKeys()
+{
+  Stack<unsigned> res;
+  for (unsigned i = 0; i < 2000; i++) {
+    res.push(i * 2654435761u);
+  }
+  return res;
+}
+
+static Stack<Term*> termKeys()
+{
+  DECL_SORT(srt)
+  DECL_FUNC(f, {srt, srt}, srt)
+  DECL_FUNC(g, {srt}, srt)
+  DECL_CONST(a, srt)
+
+  Stack<Term*> res;
+  TermSugar t = a;
+  for (unsigned i = 0; i < 1000; i++) {
+    t = g(t);
+    res.push(t.sugaredExpr().term());
+    res.push(f(t, a).sugaredExpr().term());
+  }
+  return res;
+}
+
+static Stack<Literal*> literalKeys()
+{
+  DECL_SORT(srt)
+  DECL_FUNC(g, {srt}, srt)
+  DECL_CONST(a, srt)
+  DECL_PRED(p, {srt})
+
+  Stack<Literal*> res;
+  TermSugar t = a;
+  for (unsigned i = 0; i < 1000; i++) {
+    t = g(t);
+    res.push(p(t));
+    res.push(~p(t));
+  }
+  return res;
+}
+
+BENCH_FUN(dhmap_insert_unsigned)
+{ benchInsert<DHMap<unsigned, unsigned>>(bench, unsignedKeys()); }
+
+BENCH_FUN(swissmap_insert_unsigned)
+{ benchInsert<SwissMap<unsigned, unsigned>>(bench, unsignedKeys()); }
+
+BENCH_FUN(dhmap_find_unsigned)
+{ benchFind<DHMap<unsigned, unsigned>>(bench, unsignedKeys()); }
+
+BENCH_FUN(swissmap_find_unsigned)
+{ benchFind<SwissMap<unsigned, unsigned>>(bench, unsignedKeys()); }
+
+BENCH_FUN(dhmap_find_term)
+{ benchFind<DHMap<Term*, unsigned>>(bench, termKeys()); }
+
+BENCH_FUN(swissmap_find_term)
+{ benchFind<SwissMap<Term*, unsigned>>(bench, termKeys()); }
+
+BENCH_FUN(dhmap_find_literal)
+{ benchFind<DHMap<Literal*, unsigned>>(bench, literalKeys()); }
+
+BENCH_FUN(swissmap_find_literal)
+{ benchFind<SwissMap<Literal*, unsigned>>(bench, literalKeys()); }
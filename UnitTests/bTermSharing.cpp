@@ -0,0 +1,47 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Kernel/Term.hpp"
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Kernel;
+using namespace Test;
+
+BENCH_FUN(create_existing)
+{
+  DECL_SORT(srt)
+  DECL_FUNC(f, {srt, srt}, srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+
+  TermList args[] = { a, b };
+  auto fn = f.functor();
+  Term::create(fn, 2, args);
+
+  // the term is found in the sharing index
+  bench.measure([&]() { doNotOptimize(Term::create(fn, 2, args)); });
+}
+
+BENCH_FUN(create_new)
+{
+  DECL_SORT(srt)
+  DECL_FUNC(f, {srt, srt}, srt)
+  DECL_CONST(a, srt)
+
+  auto fn = f.functor();
+  TermList cur = a;
+
+  // every iteration creates (and inserts into the sharing index) a term that has not been seen before
+  bench.measure([&]() {
+    cur = TermList(Term::create2(fn, cur, a));
+    doNotOptimize(cur);
+  });
+}
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Lib/Allocator.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+using namespace Lib;
+
+#ifndef INDIVIDUAL_ALLOCATIONS
+
+TEST_FUN(reclaimFreeBlocks)
+{
+  FixedSizeAllocator<16> fsa;
+  Stack<void *> chunks;
+
+  // enough chunks to fill several blocks
+  for(unsigned i = 0; i < 5000; i++)
+    chunks.push(fsa.alloc());
+
+  // nothing free, nothing to reclaim
+  ASS_EQ(fsa.reclaim(), 0)
+
+  for(void *chunk : chunks)
+    fsa.free(chunk);
+
+  // blocks of 1024 chunks, the first reserved: the 5000 chunks took four full
+  // blocks and part of a fifth, the current one, and only the full ones go back
+  ASS_EQ(fsa.reclaim(), 4 * 1024 * 16)
+
+  // a second call has nothing to do
+  ASS_EQ(fsa.reclaim(), 0)
+
+  // the allocator is still usable afterwards
+  chunks.reset();
+  for(unsigned i = 0; i < 5000; i++)
+    chunks.push(fsa.alloc());
+  for(void *chunk : chunks)
+    fsa.free(chunk);
+}
+
+TEST_FUN(reclaimKeepsBlocksInUse)
+{
+  FixedSizeAllocator<16> fsa;
+  Stack<void *> chunks;
+
+  for(unsigned i = 0; i < 5000; i++)
+    chunks.push(fsa.alloc());
+
+  // keep every 100th chunk alive: no block is completely free
+  for(unsigned i = 0; i < chunks.size(); i++)
+    if(i % 100)
+      fsa.free(chunks[i]);
+  ASS_EQ(fsa.reclaim(), 0)
+
+  // chunks surviving in the free list can still be handed out
+  for(unsigned i = 0; i < 4000; i++)
+    fsa.alloc();
+}
+
+#endif
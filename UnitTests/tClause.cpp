@@ -0,0 +1,87 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/KBO.hpp"
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Kernel;
+
+/** check the cached order of the selected literals of @b cl against @b ord */
+void checkSelectedLiteralOrder(Clause* cl, const Ordering& ord)
+{
+  unsigned cnt = cl->orderedSelected();
+  for (unsigned i = 0; i < cl->numSelected(); i++) {
+    for (unsigned j = 0; j < cl->numSelected(); j++) {
+      bool greater = i < cnt && j < cnt && ord.compare((*cl)[i], (*cl)[j]) == Ordering::GREATER;
+      ASS_EQ(cl->selectedLiteralGreater(i, j), greater)
+    }
+  }
+}
+
+TEST_FUN(selected_literal_order) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(s)
+  DECL_FUNC(f, {s}, s)
+  DECL_CONST(a, s)
+  DECL_PRED(p, {s})
+  DECL_PRED(q, {s})
+
+  auto ord = KBO::testKBO();
+  Clause* cl = clause({ selected(p(f(x))), selected(p(x)), selected(q(y)), p(f(f(x))) });
+  cl->computeSelectedLiteralOrder(ord);
+  ASS(cl->hasSelectedLiteralOrder())
+  ASS_EQ(cl->numSelected(), 3u)
+
+  // p(f(x)) > p(x), q(y) is incomparable with both
+  ASS(cl->selectedLiteralGreater(0, 1))
+  ASS(!cl->selectedLiteralGreater(1, 0))
+  ASS(!cl->selectedLiteralGreater(0, 2))
+  ASS(!cl->selectedLiteralGreater(2, 0))
+  ASS(!cl->selectedLiteralGreater(1, 2))
+  ASS(!cl->selectedLiteralGreater(2, 1))
+  checkSelectedLiteralOrder(cl, ord);
+
+  // reselection discards the order
+  cl->setSelected(1);
+  ASS(!cl->hasSelectedLiteralOrder())
+  cl->computeSelectedLiteralOrder(ord);
+  ASS(!cl->hasSelectedLiteralOrder())
+}
+
+TEST_FUN(selected_literal_order_beyond_max) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(s)
+  DECL_FUNC(f, {s}, s)
+  DECL_CONST(a, s)
+  DECL_PRED(p, {s})
+
+  auto ord = KBO::testKBO();
+  // p(a), p(f(a)), p(f(f(a))), ... each literal greater than the ones before it
+  unsigned len = Clause::MAX_ORDERED_SELECTED + 4;
+  Clause* cl = new(len) Clause(len, NonspecificInference0(UnitInputType::AXIOM, InferenceRule::INPUT));
+  TermSugar t = a;
+  for (unsigned i = 0; i < len; i++) {
+    (*cl)[i] = p(t);
+    t = f(t);
+  }
+  cl->setSelected(len);
+  cl->computeSelectedLiteralOrder(ord);
+  ASS(cl->hasSelectedLiteralOrder())
+  ASS_EQ(cl->numSelected(), Clause::MAX_ORDERED_SELECTED + 4)
+
+  // only the first MAX_ORDERED_SELECTED selected literals are covered
+  ASS(cl->selectedLiteralGreater(Clause::MAX_ORDERED_SELECTED - 1, 0))
+  ASS(!cl->selectedLiteralGreater(Clause::MAX_ORDERED_SELECTED, 0))
+  ASS(!cl->selectedLiteralGreater(Clause::MAX_ORDERED_SELECTED + 3, Clause::MAX_ORDERED_SELECTED))
+  checkSelectedLiteralOrder(cl, ord);
+}
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Kernel/Clause.hpp"
+#include "Indexing/ClauseVariantIndex.hpp"
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Indexing;
+
+#define MY_SYNTAX_SUGAR                                                                             \
+  DECL_DEFAULT_VARS                                                                                 \
+  DECL_SORT(s)                                                                                      \
+  DECL_FUNC(f, {s}, s)                                                                              \
+  DECL_CONST(a, s)                                                                                  \
+  DECL_PRED(p, {s, s})                                                                              \
+  DECL_PRED(q, {s})
+
+/** a clause kept by the saturation algorithm, with a reference of the test */
+Clause* kept(Clause* cl)
+{
+  cl->setStore(Clause::PASSIVE);
+  cl->incRefCnt();
+  return cl;
+}
+
+unsigned countVariants(ClauseVariantFilter& filter, Clause* cl)
+{
+  return countIteratorElements(filter.retrieveVariants(cl));
+}
+
+TEST_FUN(variant_hit) {
+  MY_SYNTAX_SUGAR
+  ClauseVariantFilter filter;
+
+  Clause* cl = kept(clause({ p(x, f(y)), q(x) }));
+  filter.insert(cl);
+
+  // renamed and with the literals in a different order
+  auto it = filter.retrieveVariants(clause({ q(z), p(z, f(x)) }));
+  ASS(it.hasNext())
+  ASS_EQ(it.next(), cl)
+  ASS(!it.hasNext())
+
+  ASS_EQ(countVariants(filter, clause({ p(x, f(y)), q(y) })), 0u)
+  ASS_EQ(countVariants(filter, clause({ p(x, f(y)) })), 0u)
+
+  // inserting a clause again does not duplicate it
+  filter.insert(cl);
+  ASS_EQ(countVariants(filter, cl), 1u)
+}
+
+// p(x,y) \/ q(x) and p(x,y) \/ q(y) hash the same, as the hash ignores which
+// variable is which, so the Bloom filter lets the query through
+TEST_FUN(false_positive_rejected) {
+  MY_SYNTAX_SUGAR
+  ClauseVariantFilter filter;
+
+  Clause* cl = kept(clause({ p(x, y), q(x) }));
+  Clause* query = clause({ p(x, y), q(y) });
+  ASS_EQ(HashingClauseVariantIndex::computeHash(cl->literals(), cl->length()),
+         HashingClauseVariantIndex::computeHash(query->literals(), query->length()))
+
+  filter.insert(cl);
+  ASS_EQ(countVariants(filter, query), 0u)
+  ASS_EQ(countVariants(filter, cl), 1u)
+}
+
+// clauses that left the containers are no longer reported
+TEST_FUN(released_on_retrieval) {
+  MY_SYNTAX_SUGAR
+  ClauseVariantFilter filter;
+
+  Clause* cl = kept(clause({ p(x, a), q(x) }));
+  filter.insert(cl);
+  ASS_EQ(countVariants(filter, cl), 1u)
+
+  cl->setStore(Clause::NONE);
+  ASS_EQ(countVariants(filter, cl), 0u)
+
+  // the clause may come back, e.g. when reintroduced by the splitter
+  cl->setStore(Clause::ACTIVE);
+  filter.insert(cl);
+  ASS_EQ(countVariants(filter, cl), 1u)
+}
+
+// enough insertions trigger a purge of the whole index, which rebuilds the
+// Bloom filter from the clauses still kept
+TEST_FUN(after_purge) {
+  MY_SYNTAX_SUGAR
+  ClauseVariantFilter filter;
+
+  Stack<Clause*> cls;
+  TermSugar t = x;
+  for (unsigned i = 0; i < 2000; i++) {
+    cls.push(kept(clause({ p(t, y), q(y) })));
+    filter.insert(cls.top());
+    t = f(t);
+  }
+  for (unsigned i = 0; i < cls.size(); i++) {
+    if (i % 4) {
+      cls[i]->setStore(Clause::NONE);
+    }
+  }
+
+  // the first retrieval purges the index
+  for (unsigned i = 0; i < cls.size(); i++) {
+    ASS_EQ(countVariants(filter, cls[i]), i % 4 ? 0u : 1u)
+  }
+
+  // and the index keeps working for the clauses inserted afterwards
+  for (unsigned i = 1; i < cls.size(); i += 4) {
+    cls[i]->setStore(Clause::PASSIVE);
+    filter.insert(cls[i]);
+  }
+  for (unsigned i = 0; i < cls.size(); i++) {
+    ASS_EQ(countVariants(filter, cls[i]), i % 4 < 2 ? 1u : 0u)
+  }
+}
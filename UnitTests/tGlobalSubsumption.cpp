@@ -0,0 +1,70 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Kernel/Grounder.hpp"
+#include "Indexing/GroundingIndex.hpp"
+#include "Inferences/GlobalSubsumption.hpp"
+#include "Shell/Options.hpp"
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Inferences;
+using namespace Indexing;
+
+TEST_FUN(deferred_reduction) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_PRED(p, {s})
+  DECL_PRED(q, {s})
+
+  Options opt;
+  opt.set("global_subsumption_deferred", "1");
+  GroundingIndex index(opt);
+  GlobalSubsumption gs(opt, &index);
+
+  Clause* unit = clause({ p(a) });
+  Clause* reducible = clause({ p(a), q(b) });
+  // keep the clauses alive once the queue lets go of them
+  unit->incRefCnt();
+  reducible->incRefCnt();
+
+  Stack<Unit*> prems;
+  ASS_EQ(gs.perform(unit, prems), unit)
+
+  // the forward simplification leaves the reduction to the saturation algorithm
+  Clause* replacement;
+  ClauseIterator premises;
+  ASS(!gs.perform(reducible, replacement, premises))
+
+  gs.addDeferred(reducible);
+  gs.addDeferred(unit);
+
+  ASS(gs.hasDeferred())
+  Clause* cl = gs.popDeferred();
+  ASS_EQ(cl, reducible)
+  replacement = gs.perform(cl, prems);
+  ASS_NEQ(replacement, cl)
+  ASS_EQ(replacement->length(), 1u)
+  ASS_EQ((*replacement)[0], (*unit)[0])
+  ASS(prems.find(cl))
+  ASS(prems.find(unit))
+  cl->decRefCnt();
+
+  ASS(gs.hasDeferred())
+  cl = gs.popDeferred();
+  ASS_EQ(cl, unit)
+  ASS_EQ(gs.perform(cl, prems), cl)
+  cl->decRefCnt();
+
+  ASS(!gs.hasDeferred())
+}
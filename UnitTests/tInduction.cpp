@@ -20,6 +20,8 @@
 #include "Indexing/LiteralSubstitutionTree.hpp"
 #include "Indexing/TermIndex.hpp"
 #include "Indexing/TermSubstitutionTree.hpp"
+#include "Kernel/Formula.hpp"
+#include "Kernel/FormulaUnit.hpp"
 #include "Kernel/RobSubstitution.hpp"
 
 #include "Inferences/Induction.hpp"
@@ -1117,6 +1119,114 @@ TEST_GENERATION_INDUCTION(test_33,
       })
     )
 
+// cached clausification gives the same clauses as test_04
+TEST_GENERATION_INDUCTION(test_34,
+    Generation::TestCase()
+      .options({ { "induction", "struct" }, { "induction_clausification_cache", "on" } })
+      .indices(getIndices())
+      .input( clause({  ~p(f(sK1,sK2)) }))
+      .expected({
+        clause({ ~p(f(b,sK2)), p(f(skx0,sK2)) }),
+        clause({ ~p(f(b,sK2)), ~p(f(r(skx0),sK2)) }),
+        clause({ ~p(f(sK1,b)), p(f(sK1,skx1)) }),
+        clause({ ~p(f(sK1,b)), ~p(f(sK1,r(skx1))) }),
+      })
+      .preConditions({ TEST_FN_ASS_EQ(env.statistics->structInduction, 0) })
+      .postConditions({ TEST_FN_ASS_EQ(env.statistics->structInduction, 2) })
+    )
+
+// the two upward inductions of test_16 share their clausification
+TEST_GENERATION_INDUCTION(test_35,
+    Generation::TestCase()
+      .options({ { "induction", "int" },
+                 { "int_induction_interval", "infinite" },
+                 { "int_induction_default_bound", "on" },
+                 { "induction_clausification_cache", "on" } })
+      .context({ clause({ ~(sK6 < num(0)) }) })
+      .indices(getIndices())
+      .input( clause({ ~pi(sK6) }) )
+      .expected({
+        clause({ ~pi(0), ~(skx0 < num(0)) }),
+        clause({ ~pi(0), pi(skx0) }),
+        clause({ ~pi(0), ~pi(skx0+1) }),
+
+        clause({ ~pi(0), ~(skx1 < num(0)), sK6 < 0 }),
+        clause({ ~pi(0), pi(skx1), sK6 < 0 }),
+        clause({ ~pi(0), ~pi(skx1+1), sK6 < 0 }),
+
+        clause({ ~pi(0), ~(num(0) < skx2), 0 < sK6 }),
+        clause({ ~pi(0), pi(skx2), 0 < sK6 }),
+        clause({ ~pi(0), ~pi(skx2+num(-1)), 0 < sK6 }),
+      })
+    )
+
+// instances of a formula differing in a ground subterm: the second one is
+// instantiated from the cached clauses, with a fresh copy of the Skolem constant
+TEST_FUN(clausification_cache_01) {
+  __ALLOW_UNUSED(MY_SYNTAX_SUGAR);
+  InductionClausificationCache cache;
+
+  // (![X]: p(f(X,c))) => p(c) gives ~p(f(sk,c)) \/ p(c)
+  auto clausify = [&](TermSugar c) {
+    Formula* lhs = new QuantifiedFormula(FORALL, VList::singleton(x.sugaredExpr().var()), SList::empty(),
+        new AtomicFormula(p(f(x,c))));
+    Formula* hyp = new BinaryFormula(IMP, lhs, new AtomicFormula(p(c)));
+    ClauseStack res = cache.clausify(new FormulaUnit(hyp,
+        NonspecificInference0(UnitInputType::AXIOM, InferenceRule::STRUCT_INDUCTION_AXIOM)));
+    ASS_EQ(res.size(), 1);
+    return res[0];
+  };
+  // the Skolem constant in the clause, checking the rest of it
+  auto skolemIn = [&](Clause* cl, TermSugar c) {
+    ASS_EQ(cl->length(), 2);
+    Literal* neg = (*cl)[0]->polarity() ? (*cl)[1] : (*cl)[0];
+    TermList sk = *neg->nthArgument(0)->term()->nthArgument(0);
+    ASS(sk.isTerm() && sk.term()->arity() == 0);
+    ASS(env.signature->getFunction(sk.term()->functor())->skolem());
+    Stack<Literal*> expected = { ~p(f(TermSugar(sk),c)), p(c) };
+    ASS(TestUtils::permEq(*cl, expected, [](Literal* l, Literal* r) { return l == r; }));
+    return sk;
+  };
+
+  TermList sk1 = skolemIn(clausify(sK1), sK1);
+  unsigned skolemized = env.statistics->skolemFunctions;
+  unsigned functions = env.signature->functions();
+  TermList sk2 = skolemIn(clausify(sK2), sK2);
+
+  ASS_NEQ(sk1, sk2);
+  // the copy of the Skolem constant is counted like a fresh one
+  ASS_EQ(env.statistics->skolemFunctions, skolemized+1);
+  ASS_EQ(env.signature->functions(), functions+1);
+}
+
+// the clauses instantiated from the cache are derived by the same steps as fresh ones
+TEST_FUN(clausification_cache_02) {
+  __ALLOW_UNUSED(MY_SYNTAX_SUGAR);
+  InductionClausificationCache cache;
+
+  auto clausify = [&](TermSugar c) {
+    Formula* lhs = new QuantifiedFormula(FORALL, VList::singleton(x.sugaredExpr().var()), SList::empty(),
+        new AtomicFormula(p(f(x,c))));
+    Formula* hyp = new BinaryFormula(IMP, lhs, new AtomicFormula(p(c)));
+    FormulaUnit* fu = new FormulaUnit(hyp,
+        NonspecificInference0(UnitInputType::AXIOM, InferenceRule::STRUCT_INDUCTION_AXIOM));
+    ClauseStack res = cache.clausify(fu);
+    ASS_EQ(res.size(), 1);
+    // CLAUSIFY <- ENNF <- the induction formula
+    Inference& inf = res[0]->inference();
+    ASS(inf.rule() == InferenceRule::CLAUSIFY);
+    auto it = inf.iterator();
+    Unit* ennf = inf.next(it);
+    ASS(!inf.hasNext(it));
+    ASS(ennf->inference().rule() == InferenceRule::ENNF);
+    auto eit = ennf->inference().iterator();
+    ASS_EQ(ennf->inference().next(eit), fu);
+  };
+
+  clausify(sK1);
+  clausify(sK2);
+}
+
 // no generalization
 TEST_FUN(generalizations_01) {
   __ALLOW_UNUSED(MY_SYNTAX_SUGAR);
@@ -0,0 +1,97 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include <cstdio>
+#include <fstream>
+
+#include "Shell/Options.hpp"
+#include "Saturation/LearnedPassiveClauseContainer.hpp"
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Saturation;
+
+static const char* MODEL_FILE = "tLearnedPassiveClauseContainer.model";
+
+static void writeModel(const char* content)
+{
+  std::ofstream out(MODEL_FILE);
+  out << content;
+}
+
+/** score = 1 + 3*relu(weight - 2) */
+static const char* HIDDEN_MODEL =
+  "# a comment\n"
+  "inputs 10 hidden 1\n"
+  "1 0 0 0 0 0 0 0 0 0  -2 # hidden weights and bias\n"
+  "3 1\n";
+
+/** score = weight */
+static const char* LINEAR_MODEL =
+  "inputs 10 hidden 0\n"
+  "1 0 0 0 0 0 0 0 0 0  0\n";
+
+TEST_FUN(model_parsing_and_scoring) {
+  writeModel(HIDDEN_MODEL);
+  ClauseScoringModel model(MODEL_FILE);
+  std::remove(MODEL_FILE);
+
+  float features[ClauseScoringModel::NUM_FEATURES*ClauseScoringModel::BATCH_SIZE] = {};
+  float scores[ClauseScoringModel::BATCH_SIZE];
+  // the first feature of the first three batch columns
+  features[0] = 5;
+  features[1] = 1;
+  features[2] = 2;
+  model.score(features, scores);
+
+  ASS_EQ(scores[0], 10.0f)
+  ASS_EQ(scores[1], 1.0f)
+  ASS_EQ(scores[2], 1.0f)
+}
+
+TEST_FUN(add_remove_pop) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(s)
+  DECL_FUNC(f, {s}, s)
+  DECL_CONST(a, s)
+  DECL_PRED(p, {s})
+
+  writeModel(LINEAR_MODEL);
+  Options opt;
+  opt.set("clause_selection_model", MODEL_FILE);
+  opt.set("age_weight_ratio", "0:1");
+  LearnedPassiveClauseContainer container(false, opt);
+  std::remove(MODEL_FILE);
+
+  Clause* light = clause({ p(a) });
+  Clause* middle = clause({ p(f(a)) });
+  Clause* heavy = clause({ p(f(f(a))) });
+  Clause* unscored = clause({ p(f(f(f(a)))) });
+  for (Clause* cl : { heavy, middle, light }) {
+    cl->setStore(Clause::PASSIVE);
+    container.add(cl);
+  }
+
+  // selection scores the whole container
+  ASS_EQ(container.popSelected(), light)
+
+  // removing scored and unscored clauses
+  middle->setStore(Clause::NONE);
+  container.remove(middle);
+  unscored->setStore(Clause::PASSIVE);
+  container.add(unscored);
+  unscored->setStore(Clause::NONE);
+  container.remove(unscored);
+  ASS_EQ(container.sizeEstimate(), 1u)
+
+  ASS_EQ(container.popSelected(), heavy)
+  ASS(container.isEmpty())
+}
@@ -66,3 +66,54 @@ TEST_FUN(stackDelIterator)
     }
   }
 }
+
+TEST_FUN(inlineStack)
+{
+  InlineStack<unsigned, 4> st1;
+  for(unsigned i=0;i<4;i++) {
+    st1.push(i);
+  }
+  // still in the inline buffer
+  ASS_EQ(st1.end()-st1.begin(),4);
+  for(unsigned i=4;i<100;i++) {
+    st1.push(i);
+  }
+  ASS_EQ(st1.size(),100u);
+  for(unsigned i=0;i<100;i++) {
+    ASS_EQ(st1[i],i);
+  }
+
+  // moving out of an inline buffer must copy the elements, not the pointer to the buffer
+  InlineStack<unsigned, 4> st2;
+  st2.push(1);
+  st2.push(2);
+  Stack<unsigned> st3(std::move(st2));
+  ASS_EQ(st3.size(),2u);
+  ASS_EQ(st3.top(),2u);
+  st2.push(3);
+  ASS_EQ(st3.top(),2u);
+  ASS_EQ(st2.top(),3u);
+
+  // moving into an inline stack takes over the allocated buffer
+  InlineStack<unsigned, 4> st4;
+  st4.push(7);
+  static_cast<Stack<unsigned>&>(st4) = std::move(st1);
+  ASS_EQ(st4.size(),100u);
+  ASS_EQ(st4.top(),99u);
+  ASS(st1.isEmpty());
+
+  // moving between inline stacks, with and without room for the elements
+  static_cast<Stack<unsigned>&>(st1) = std::move(st2);
+  ASS_EQ(st1.size(),1u);
+  ASS_EQ(st1.top(),3u);
+  ASS(st2.isEmpty());
+  static_cast<Stack<unsigned>&>(st2) = std::move(st4);
+  ASS_EQ(st2.size(),100u);
+  ASS_EQ(st2[50],50u);
+
+  Stack<unsigned>& st1Ref = st1;
+  std::swap(st1Ref, st3);
+  ASS_EQ(st1.size(),2u);
+  ASS_EQ(st1.top(),2u);
+  ASS_EQ(st3.top(),3u);
+}
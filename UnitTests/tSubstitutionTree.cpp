@@ -0,0 +1,101 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Indexing/TermSubstitutionTree.hpp"
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+using namespace Kernel;
+using namespace Indexing;
+using namespace Test;
+
+static unsigned countUnifications(TermSubstitutionTree& index, TypedTermList query)
+{
+  unsigned res = 0;
+  auto it = index.getUnifications(query, /* retrieveSubstitutions */ true, /* withConstraints */ false);
+  while (it.hasNext()) {
+    it.next();
+    res++;
+  }
+  return res;
+}
+
+/**
+ * With any budget, the estimate for @b query is at least the number of its
+ * unifications and at most the number of entries, @b size. With a variable
+ * query, every subtree counts as a whole, so the estimate is exactly the number
+ * of entries whichever nodes the budget allows to visit, which checks the entry
+ * counters in all of them.
+ */
+static void checkEstimates(TermSubstitutionTree& index, unsigned size, TypedTermList var, TypedTermList query)
+{
+  unsigned exact = countUnifications(index, query);
+  for (unsigned budget = 0; budget < 50; budget++) {
+    ASS_EQ(index.estimateUnificationCount(var, budget), size)
+
+    size_t estimate = index.estimateUnificationCount(query, budget);
+    ASS_LE(exact, estimate)
+    ASS_LE(estimate, size)
+  }
+}
+
+TEST_FUN(entry_counts_and_estimates) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_FUNC(f, {srt, srt}, srt)
+  DECL_FUNC(g, {srt}, srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+  DECL_PRED(p, {srt})
+
+  TermSubstitutionTree index;
+  Stack<TermSugar> terms;
+  Stack<Clause*> clauses;
+  TermSugar gi = a;
+  for (unsigned i = 0; i < 6; i++) {
+    TermSugar gj = b;
+    for (unsigned j = 0; j < 6; j++) {
+      for (auto t : { f(gi, gj), f(gi, x), f(x, gj) }) {
+        terms.push(t);
+        clauses.push(clause({ p(t) }));
+      }
+      gj = g(gj);
+    }
+    gi = g(gi);
+  }
+  // variables of TermSugar do not carry a sort
+  auto typed = [&](TermSugar t) { return TypedTermList(t.sugaredExpr(), srt.sugaredExpr()); };
+  auto handle = [&](unsigned i, bool insert) {
+    index.handle(typed(terms[i]), (*clauses[i])[0], clauses[i], insert);
+  };
+
+  TypedTermList var = typed(x);
+  TypedTermList query = typed(f(g(g(a)), y));
+
+  unsigned size = 0;
+  for (unsigned i = 0; i < terms.size(); i++) {
+    handle(i, true);
+    size++;
+  }
+  checkEstimates(index, size, var, query);
+  ASS_EQ(index.estimateUnificationCount(query, 0), size)
+
+  // remove every other entry, and insert some of them back
+  for (unsigned i = 0; i < terms.size(); i += 2) {
+    handle(i, false);
+    size--;
+  }
+  checkEstimates(index, size, var, query);
+  for (unsigned i = 0; i < terms.size(); i += 4) {
+    handle(i, true);
+    size++;
+  }
+  checkEstimates(index, size, var, query);
+}
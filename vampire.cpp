@@ -674,6 +674,7 @@ int main(int argc, char* argv[])
     cl.interpret(*env.options);
 #if VTIME_PROFILING
     TimeTrace::instance().setEnabled(env.options->timeStatistics());
+    TimeTrace::instance().setCountInstructions(env.options->timeStatisticsInstructions());
 #endif
 
     // If any of these options are set then we just need to output and exit